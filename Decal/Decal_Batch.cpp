@@ -0,0 +1,317 @@
+#include "Decal_Batch.h"
+#include "Shader.h"
+#include "VIBuffer.h"
+
+CDecal_Batch::CDecal_Batch(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
+    : m_pDevice{ pDevice }
+    , m_pContext{ pContext }
+{
+    Safe_AddRef(m_pDevice);
+    Safe_AddRef(m_pContext);
+}
+
+HRESULT CDecal_Batch::Initialize(_uint iInitialCapacity)
+{
+    return Reserve(max(iInitialCapacity, 1u));
+}
+
+void CDecal_Batch::Submit(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fElapsedTime, _float fLifeTime)
+{
+    m_Packer.Add(iMaterialID, WorldMatrix, vBoxSize, vColor, fElapsedTime, fLifeTime);
+}
+
+void CDecal_Batch::Cull(_fmatrix ViewProjMatrix, _fvector vCamPosition, _float fMaxDistance)
+{
+    auto& Submitted = m_Packer.Get_Submitted();
+
+    m_Culler.Clear();
+    m_Culler.Reserve((_uint)Submitted.size());
+
+    //   ״ ־ ÷ ε = Ŀ  ε
+    for (auto& tInstance : Submitted)
+        m_Culler.Add_Box(tInstance.WorldMatrix, _float3(tInstance.vBoxSize.x, tInstance.vBoxSize.y, tInstance.vBoxSize.z));
+
+    _float4x4 ViewProj;
+    _float3 vCamPos;
+    XMStoreFloat4x4(&ViewProj, ViewProjMatrix);
+    XMStoreFloat3(&vCamPos, vCamPosition);
+
+    m_Culler.Cull(ViewProj, vCamPos, fMaxDistance);
+    m_bCulled = true;
+}
+
+HRESULT CDecal_Batch::Render_Batches(CShader* pShader, CVIBuffer* pVIBuffer, _uint iPassIndex, const MATERIAL_BINDER& BindMaterial)
+{
+    m_iNumDrawCalls = 0;
+
+    if (!pShader || !pVIBuffer)
+        return E_FAIL;
+
+    Pack();
+    if (m_Packer.Get_Instances().empty())
+        return S_OK;
+
+    if (FAILED(Upload()))
+        return E_FAIL;
+
+    if (FAILED(pShader->Bind_SRV("g_DecalInstances", m_pInstanceSRV)))
+        return E_FAIL;
+
+    for (auto& tBatch : m_Packer.Get_Batches())
+    {
+        if (FAILED(Draw_Batch(pShader, pVIBuffer, iPassIndex, tBatch, BindMaterial)))
+            return E_FAIL;
+    }
+
+    return S_OK;
+}
+
+HRESULT CDecal_Batch::Render_Clustered(CShader* pShader, _uint iPassIndex, CVIBuffer* pVIBuffer, _uint iBoxPassIndex, const CDecal_ClusterBinner::DESC& tClusterDesc, _fmatrix ViewMatrix, _cmatrix ProjMatrix, const MATERIAL_BINDER& BindMaterial)
+{
+    m_iNumDrawCalls = 0;
+
+    if (!pShader || !pVIBuffer)
+        return E_FAIL;
+
+    Pack();
+    if (m_Packer.Get_Instances().empty())
+        return S_OK;
+
+    if (FAILED(Upload()))
+        return E_FAIL;
+
+    if (!m_Binner.Setup(tClusterDesc))
+        return E_FAIL;
+
+    if (FAILED(pShader->Bind_SRV("g_DecalInstances", m_pInstanceSRV)))
+        return E_FAIL;
+
+    CDecal_ClusterBinner::CLUSTER_DIMS tDims = m_Binner.Get_ClusterDims();
+    XMUINT4 vClusterDims = XMUINT4(tDims.x, tDims.y, tDims.z, tDims.w);
+    _float2 vZParams = _float2(m_Binner.Get_SliceScale(), m_Binner.Get_SliceBias());
+    if (FAILED(pShader->Bind_RawValue("g_vClusterDims", &vClusterDims, sizeof(XMUINT4))) ||
+        FAILED(pShader->Bind_RawValue("g_vClusterZParams", &vZParams, sizeof(_float2))))
+        return E_FAIL;
+
+    auto& Instances = m_Packer.Get_Instances();
+    auto& Batches = m_Packer.Get_Batches();
+
+    // Ǯũ н   ŭ þǷ νϽ   ѱ Ŭͷ
+    m_ClusteredBatches.resize(Batches.size());
+    for (_uint i = 0; i < (_uint)Batches.size(); ++i)
+        m_ClusteredBatches[i] = i;
+
+    if (m_ClusteredBatches.size() > MAX_CLUSTERED_MATERIALS)
+    {
+        partial_sort(m_ClusteredBatches.begin(), m_ClusteredBatches.begin() + MAX_CLUSTERED_MATERIALS, m_ClusteredBatches.end(), [&](_uint lhs, _uint rhs)
+            {
+                return Batches[lhs].iNumInstances > Batches[rhs].iNumInstances;
+            });
+
+        //   ڽ νϽ ( ID  )
+        sort(m_ClusteredBatches.begin() + MAX_CLUSTERED_MATERIALS, m_ClusteredBatches.end());
+        for (auto iter = m_ClusteredBatches.begin() + MAX_CLUSTERED_MATERIALS; iter != m_ClusteredBatches.end(); ++iter)
+        {
+            if (FAILED(Draw_Batch(pShader, pVIBuffer, iBoxPassIndex, Batches[*iter], BindMaterial)))
+                return E_FAIL;
+        }
+
+        m_ClusteredBatches.resize(MAX_CLUSTERED_MATERIALS);
+        sort(m_ClusteredBatches.begin(), m_ClusteredBatches.end());
+    }
+
+    _float4x4 View, Proj;
+    XMStoreFloat4x4(&View, ViewMatrix);
+    XMStoreFloat4x4(&Proj, ProjMatrix);
+
+    // ؽó  ̹Ƿ  ؼ Ǯũ  
+    for (_uint iBatch : m_ClusteredBatches)
+    {
+        auto& tBatch = Batches[iBatch];
+
+        m_Binner.Clear();
+        for (_uint i = tBatch.iStartInstance; i < tBatch.iStartInstance + tBatch.iNumInstances; ++i)
+        {
+            auto& tInstance = Instances[i];
+            m_Binner.Add_Decal(i, &tInstance.WorldMatrix._11, tInstance.vBoxSize.x, tInstance.vBoxSize.y, tInstance.vBoxSize.z);
+        }
+        m_Binner.Bin(&View._11, &Proj._11);
+
+        // ȭ鿡 ģ ŬͰ  ŵ
+        if (m_Binner.Get_DecalIndices().empty())
+            continue;
+
+        if (FAILED(Upload_TypedBuffer(&m_pClusterRangeBuffer, &m_pClusterRangeSRV, &m_iClusterRangeCapacity,
+            m_Binner.Get_ClusterRanges().data(), m_Binner.Get_NumClusters(), DXGI_FORMAT_R32G32_UINT, sizeof(CDecal_ClusterBinner::CLUSTER_RANGE))))
+            return E_FAIL;
+
+        if (FAILED(Upload_TypedBuffer(&m_pClusterIndexBuffer, &m_pClusterIndexSRV, &m_iClusterIndexCapacity,
+            m_Binner.Get_DecalIndices().data(), (_uint)m_Binner.Get_DecalIndices().size(), DXGI_FORMAT_R32_UINT, sizeof(_uint))))
+            return E_FAIL;
+
+        if (BindMaterial && FAILED(BindMaterial(pShader, tBatch.iMaterialID)))
+            continue;
+
+        if (FAILED(pShader->Bind_SRV("g_ClusterRanges", m_pClusterRangeSRV)) ||
+            FAILED(pShader->Bind_SRV("g_ClusterDecalIndices", m_pClusterIndexSRV)))
+            return E_FAIL;
+
+        if (FAILED(pShader->Begin(iPassIndex)))
+            return E_FAIL;
+
+        // VS_FULLSCREEN SV_VertexID ﰢ Ƿ    ׸
+        m_pContext->IASetInputLayout(nullptr);
+        m_pContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        m_pContext->Draw(3, 0);
+        ++m_iNumDrawCalls;
+    }
+
+    return S_OK;
+}
+
+HRESULT CDecal_Batch::Draw_Batch(CShader* pShader, CVIBuffer* pVIBuffer, _uint iPassIndex, const CDecal_InstancePacker::BATCH& tBatch, const MATERIAL_BINDER& BindMaterial)
+{
+    //  ε д   ǳʶ
+    if (BindMaterial && FAILED(BindMaterial(pShader, tBatch.iMaterialID)))
+        return S_OK;
+
+    if (FAILED(pShader->Bind_RawValue("g_iInstanceOffset", &tBatch.iStartInstance, sizeof(_uint))))
+        return E_FAIL;
+
+    if (FAILED(pShader->Begin(iPassIndex)))
+        return E_FAIL;
+
+    if (FAILED(pVIBuffer->Bind_Buffers()))
+        return E_FAIL;
+
+    //  ϳ ο  
+    m_pContext->DrawIndexedInstanced(pVIBuffer->Get_NumIndices(), tBatch.iNumInstances, 0, 0, 0);
+    ++m_iNumDrawCalls;
+
+    return S_OK;
+}
+
+HRESULT CDecal_Batch::Reserve(_uint iNumInstances)
+{
+    if (iNumInstances <= m_iCapacity)
+        return S_OK;
+
+    // 2辿 ÷  Ƚ ּȭ
+    _uint iNewCapacity = max(m_iCapacity * 2, iNumInstances);
+
+    Safe_Release(m_pInstanceSRV);
+    Safe_Release(m_pInstanceBuffer);
+
+    D3D11_BUFFER_DESC tDesc = {};
+    tDesc.ByteWidth = sizeof(CDecal_InstancePacker::DECAL_INSTANCE) * iNewCapacity;
+    tDesc.Usage = D3D11_USAGE_DYNAMIC;
+    tDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    tDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    tDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+    tDesc.StructureByteStride = sizeof(CDecal_InstancePacker::DECAL_INSTANCE);
+
+    if (FAILED(m_pDevice->CreateBuffer(&tDesc, nullptr, &m_pInstanceBuffer)))
+        return E_FAIL;
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC tSRVDesc = {};
+    tSRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+    tSRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+    tSRVDesc.Buffer.FirstElement = 0;
+    tSRVDesc.Buffer.NumElements = iNewCapacity;
+
+    if (FAILED(m_pDevice->CreateShaderResourceView(m_pInstanceBuffer, &tSRVDesc, &m_pInstanceSRV)))
+        return E_FAIL;
+
+    m_iCapacity = iNewCapacity;
+
+    return S_OK;
+}
+
+HRESULT CDecal_Batch::Upload()
+{
+    auto& Instances = m_Packer.Get_Instances();
+
+    if (FAILED(Reserve((_uint)Instances.size())))
+        return E_FAIL;
+
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    if (FAILED(m_pContext->Map(m_pInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+        return E_FAIL;
+
+    memcpy(mappedResource.pData, Instances.data(), sizeof(CDecal_InstancePacker::DECAL_INSTANCE) * Instances.size());
+
+    m_pContext->Unmap(m_pInstanceBuffer, 0);
+
+    return S_OK;
+}
+
+HRESULT CDecal_Batch::Upload_TypedBuffer(ID3D11Buffer** ppBuffer, ID3D11ShaderResourceView** ppSRV, _uint* pCapacity, const void* pData, _uint iNumElements, DXGI_FORMAT eFormat, _uint iStride)
+{
+    if (iNumElements == 0)
+        return S_OK;
+
+    if (iNumElements > *pCapacity)
+    {
+        _uint iNewCapacity = max(*pCapacity * 2, iNumElements);
+
+        Safe_Release(*ppSRV);
+        Safe_Release(*ppBuffer);
+
+        D3D11_BUFFER_DESC tDesc = {};
+        tDesc.ByteWidth = iStride * iNewCapacity;
+        tDesc.Usage = D3D11_USAGE_DYNAMIC;
+        tDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        tDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        if (FAILED(m_pDevice->CreateBuffer(&tDesc, nullptr, ppBuffer)))
+            return E_FAIL;
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC tSRVDesc = {};
+        tSRVDesc.Format = eFormat;
+        tSRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        tSRVDesc.Buffer.FirstElement = 0;
+        tSRVDesc.Buffer.NumElements = iNewCapacity;
+
+        if (FAILED(m_pDevice->CreateShaderResourceView(*ppBuffer, &tSRVDesc, ppSRV)))
+            return E_FAIL;
+
+        *pCapacity = iNewCapacity;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    if (FAILED(m_pContext->Map(*ppBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+        return E_FAIL;
+
+    memcpy(mappedResource.pData, pData, iStride * iNumElements);
+
+    m_pContext->Unmap(*ppBuffer, 0);
+
+    return S_OK;
+}
+
+CDecal_Batch* CDecal_Batch::Create(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, _uint iInitialCapacity)
+{
+    CDecal_Batch* pInstance = new CDecal_Batch(pDevice, pContext);
+
+    if (FAILED(pInstance->Initialize(iInitialCapacity)))
+    {
+        MSG_BOX("Failed To Created : CDecal_Batch");
+        Safe_Release(pInstance);
+    }
+
+    return pInstance;
+}
+
+void CDecal_Batch::Free()
+{
+    __super::Free();
+
+    Safe_Release(m_pClusterIndexSRV);
+    Safe_Release(m_pClusterIndexBuffer);
+    Safe_Release(m_pClusterRangeSRV);
+    Safe_Release(m_pClusterRangeBuffer);
+    Safe_Release(m_pInstanceSRV);
+    Safe_Release(m_pInstanceBuffer);
+    Safe_Release(m_pContext);
+    Safe_Release(m_pDevice);
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Client_Defines.h"
+#include "Base.h"
+#include "Decal_InstancePacker.h"
+#include "Decal_ClusterBinner.h"
+#include "Decal_Culler.h"
+
+BEGIN(Engine)
+class CShader;
+class CVIBuffer;
+END
+
+BEGIN(Client)
+
+//   Į νϽ StructuredBuffer ϳ     ׸ ġ 
+// CEffect_Decal Late_Update Submit ϰ,  ׷쿡 Render_Batches ϰ ó
+class CDecal_Batch final : public CBase
+{
+public:
+	// ġ (ؽó,  ) ε ȣ  ñ
+	using MATERIAL_BINDER = function<HRESULT(CShader* pShader, _uint iMaterialID)>;
+
+private:
+	CDecal_Batch(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+	virtual ~CDecal_Batch() = default;
+
+public:
+	HRESULT					Initialize(_uint iInitialCapacity);
+
+public:
+	void					Begin_Frame() { m_Packer.Clear(); m_bCulled = false; }
+	void					Submit(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fElapsedTime, _float fLifeTime);
+	//  Į  ü ̰ų ڽ 豸 fMaxDistance   (0 ϸ Ÿ ),  Render_*   ϸ ŷ
+	void					Cull(_fmatrix ViewProjMatrix, _fvector vCamPosition, _float fMaxDistance);
+	HRESULT					Render_Batches(CShader* pShader, CVIBuffer* pVIBuffer, _uint iPassIndex, const MATERIAL_BINDER& BindMaterial);
+	// Ŭ :     Ǯũ  (ڽ  )
+	//    (н /븻 ٽ а Ŭ  ٽ ȸ)ϹǷ
+	// νϽ   MAX_CLUSTERED_MATERIALS Ŭͷ,   pVIBuffer ڽ νϽ(iBoxPassIndex) ׸
+	HRESULT					Render_Clustered(CShader* pShader, _uint iPassIndex, CVIBuffer* pVIBuffer, _uint iBoxPassIndex, const CDecal_ClusterBinner::DESC& tClusterDesc, _fmatrix ViewMatrix, _cmatrix ProjMatrix, const MATERIAL_BINDER& BindMaterial);
+
+	CDecal_InstancePacker&	Get_Packer() { return m_Packer; }
+	CDecal_ClusterBinner&	Get_Binner() { return m_Binner; }
+	// ø   ̴  
+	_uint					Get_NumVisible() const { return m_bCulled ? (_uint)m_Culler.Get_Visible().size() + (m_Packer.Get_NumPending() - m_Culler.Get_NumBoxes()) : m_Packer.Get_NumPending(); }
+	_uint					Get_NumDrawCalls() const { return m_iNumDrawCalls; }
+
+public:
+	static constexpr _uint	MAX_CLUSTERED_MATERIALS = 4;
+
+private:
+	HRESULT					Reserve(_uint iNumInstances);
+	HRESULT					Draw_Batch(CShader* pShader, CVIBuffer* pVIBuffer, _uint iPassIndex, const CDecal_InstancePacker::BATCH& tBatch, const MATERIAL_BINDER& BindMaterial);
+	HRESULT					Upload();
+	void					Pack() { m_Packer.Pack(m_bCulled ? &m_Culler.Get_Visible() : nullptr, m_Culler.Get_NumBoxes()); }
+	HRESULT					Upload_TypedBuffer(ID3D11Buffer** ppBuffer, ID3D11ShaderResourceView** ppSRV, _uint* pCapacity, const void* pData, _uint iNumElements, DXGI_FORMAT eFormat, _uint iStride);
+
+private:
+	ID3D11Device*				m_pDevice = { nullptr };
+	ID3D11DeviceContext*		m_pContext = { nullptr };
+
+	ID3D11Buffer*				m_pInstanceBuffer = { nullptr };
+	ID3D11ShaderResourceView*	m_pInstanceSRV = { nullptr };
+	_uint						m_iCapacity = {};
+
+	CDecal_InstancePacker		m_Packer;
+	CDecal_Culler				m_Culler;
+	_bool						m_bCulled = { false };
+
+	// Ŭ  
+	CDecal_ClusterBinner		m_Binner;
+	ID3D11Buffer*				m_pClusterRangeBuffer = { nullptr };
+	ID3D11ShaderResourceView*	m_pClusterRangeSRV = { nullptr };
+	_uint						m_iClusterRangeCapacity = {};
+	ID3D11Buffer*				m_pClusterIndexBuffer = { nullptr };
+	ID3D11ShaderResourceView*	m_pClusterIndexSRV = { nullptr };
+	_uint						m_iClusterIndexCapacity = {};
+	vector<_uint>				m_ClusteredBatches;		// ̹  Ŭͷ ׸ ġ ε()
+	_uint						m_iNumDrawCalls = {};
+
+public:
+	static CDecal_Batch*	Create(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, _uint iInitialCapacity = 256);
+	virtual void			Free() override;
+};
+
+END
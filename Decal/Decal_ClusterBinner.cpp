@@ -0,0 +1,199 @@
+#include "Decal_ClusterBinner.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace
+{
+    //  켱 4x4  (float4x4 _RC )
+    inline float M(const float* pMatrix, int iRow, int iCol) { return pMatrix[(iRow - 1) * 4 + (iCol - 1)]; }
+}
+
+namespace Client
+{
+
+bool CDecal_ClusterBinner::Setup(const DESC& tDesc)
+{
+    if (tDesc.iScreenWidth == 0 || tDesc.iScreenHeight == 0 || tDesc.iTileSize == 0 || tDesc.iNumSlices == 0)
+        return false;
+    if (tDesc.fNear <= 0.f || tDesc.fFar <= tDesc.fNear)
+        return false;
+
+    m_tDesc = tDesc;
+    m_iNumTilesX = (tDesc.iScreenWidth + tDesc.iTileSize - 1) / tDesc.iTileSize;
+    m_iNumTilesY = (tDesc.iScreenHeight + tDesc.iTileSize - 1) / tDesc.iTileSize;
+
+    //   ̽:  ϼ ϰ
+    m_fSliceScale = float(tDesc.iNumSlices) / logf(tDesc.fFar / tDesc.fNear);
+    m_fSliceBias = -logf(tDesc.fNear) * m_fSliceScale;
+
+    m_Ranges.assign(Get_NumClusters(), {});
+
+    return true;
+}
+
+void CDecal_ClusterBinner::Clear()
+{
+    m_DecalIndex.clear();
+    m_CenterX.clear(); m_CenterY.clear(); m_CenterZ.clear();
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        m_AxisX[i].clear(); m_AxisY[i].clear(); m_AxisZ[i].clear();
+    }
+    m_Indices.clear();
+}
+
+void CDecal_ClusterBinner::Add_Decal(uint32_t iDecalIndex, const float* pWorld, float fBoxSizeX, float fBoxSizeY, float fBoxSizeZ)
+{
+    // ̴ ϰ  |p| <= vBoxSize * 0.5  ڽ 
+    const float fHalf[3] = { fBoxSizeX * 0.5f, fBoxSizeY * 0.5f, fBoxSizeZ * 0.5f };
+
+    m_DecalIndex.push_back(iDecalIndex);
+    m_CenterX.push_back(M(pWorld, 4, 1));
+    m_CenterY.push_back(M(pWorld, 4, 2));
+    m_CenterZ.push_back(M(pWorld, 4, 3));
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        m_AxisX[i].push_back(pWorld[i * 4 + 0] * fHalf[i]);
+        m_AxisY[i].push_back(pWorld[i * 4 + 1] * fHalf[i]);
+        m_AxisZ[i].push_back(pWorld[i * 4 + 2] * fHalf[i]);
+    }
+}
+
+void CDecal_ClusterBinner::Bin(const float* pView, const float* pProj)
+{
+    const uint32_t iNumDecals = Get_NumDecals();
+    const uint32_t iNumClusters = Get_NumClusters();
+
+    m_Ranges.assign(iNumClusters, {});
+    m_Indices.clear();
+
+    if (iNumDecals == 0 || iNumClusters == 0)
+        return;
+
+    const float V11 = M(pView, 1, 1), V12 = M(pView, 1, 2), V13 = M(pView, 1, 3);
+    const float V21 = M(pView, 2, 1), V22 = M(pView, 2, 2), V23 = M(pView, 2, 3);
+    const float V31 = M(pView, 3, 1), V32 = M(pView, 3, 2), V33 = M(pView, 3, 3);
+    const float V41 = M(pView, 4, 1), V42 = M(pView, 4, 2), V43 = M(pView, 4, 3);
+    const float P11 = M(pProj, 1, 1), P22 = M(pProj, 2, 2), P31 = M(pProj, 3, 1), P32 = M(pProj, 3, 2);
+
+    m_ViewMinX.resize(iNumDecals); m_ViewMaxX.resize(iNumDecals);
+    m_ViewMinY.resize(iNumDecals); m_ViewMaxY.resize(iNumDecals);
+    m_ViewMinZ.resize(iNumDecals); m_ViewMaxZ.resize(iNumDecals);
+    m_Bounds.resize(iNumDecals);
+
+    // 1.   AABB(SoA, б )
+    // OBB AABB  ũ =     
+    const float* pCX = m_CenterX.data(); const float* pCY = m_CenterY.data(); const float* pCZ = m_CenterZ.data();
+    for (uint32_t i = 0; i < iNumDecals; ++i)
+    {
+        float fCX = pCX[i] * V11 + pCY[i] * V21 + pCZ[i] * V31 + V41;
+        float fCY = pCX[i] * V12 + pCY[i] * V22 + pCZ[i] * V32 + V42;
+        float fCZ = pCX[i] * V13 + pCY[i] * V23 + pCZ[i] * V33 + V43;
+
+        float fEX = 0.f, fEY = 0.f, fEZ = 0.f;
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+            float fAX = m_AxisX[k][i], fAY = m_AxisY[k][i], fAZ = m_AxisZ[k][i];
+            fEX += fabsf(fAX * V11 + fAY * V21 + fAZ * V31);
+            fEY += fabsf(fAX * V12 + fAY * V22 + fAZ * V32);
+            fEZ += fabsf(fAX * V13 + fAY * V23 + fAZ * V33);
+        }
+
+        m_ViewMinX[i] = fCX - fEX; m_ViewMaxX[i] = fCX + fEX;
+        m_ViewMinY[i] = fCY - fEY; m_ViewMaxY[i] = fCY + fEY;
+        m_ViewMinZ[i] = fCZ - fEZ; m_ViewMaxZ[i] = fCZ + fEZ;
+    }
+
+    // 2. Ŭ   + Ŭͺ  
+    const float fWidth = float(m_tDesc.iScreenWidth);
+    const float fHeight = float(m_tDesc.iScreenHeight);
+    const float fInvTile = 1.f / float(m_tDesc.iTileSize);
+
+    for (uint32_t i = 0; i < iNumDecals; ++i)
+    {
+        CLUSTER_BOUNDS& tBounds = m_Bounds[i];
+        tBounds = { 1, 0, 1, 0, 1, 0 };
+
+        float fMinZ = m_ViewMinZ[i], fMaxZ = m_ViewMaxZ[i];
+        if (fMaxZ < m_tDesc.fNear || fMinZ > m_tDesc.fFar)
+            continue;
+
+        float fNdcMinX = -1.f, fNdcMaxX = 1.f, fNdcMinY = -1.f, fNdcMaxY = 1.f;
+
+        //    ҾϹǷ ȭ ü  ó
+        if (fMinZ > m_tDesc.fNear)
+        {
+            // x/z   ̹Ƿ AABB 𼭸  տ ذ
+            float fInvMinZ = 1.f / fMinZ, fInvMaxZ = 1.f / fMaxZ;
+
+            float fX0 = m_ViewMinX[i] * fInvMinZ, fX1 = m_ViewMinX[i] * fInvMaxZ;
+            float fX2 = m_ViewMaxX[i] * fInvMinZ, fX3 = m_ViewMaxX[i] * fInvMaxZ;
+            float fY0 = m_ViewMinY[i] * fInvMinZ, fY1 = m_ViewMinY[i] * fInvMaxZ;
+            float fY2 = m_ViewMaxY[i] * fInvMinZ, fY3 = m_ViewMaxY[i] * fInvMaxZ;
+
+            fNdcMinX = min(min(fX0, fX1), min(fX2, fX3)) * P11 + P31;
+            fNdcMaxX = max(max(fX0, fX1), max(fX2, fX3)) * P11 + P31;
+            fNdcMinY = min(min(fY0, fY1), min(fY2, fY3)) * P22 + P32;
+            fNdcMaxY = max(max(fY0, fY1), max(fY2, fY3)) * P22 + P32;
+
+            if (fNdcMaxX < -1.f || fNdcMinX > 1.f || fNdcMaxY < -1.f || fNdcMinY > 1.f)
+                continue;
+
+            fNdcMinX = max(fNdcMinX, -1.f); fNdcMaxX = min(fNdcMaxX, 1.f);
+            fNdcMinY = max(fNdcMinY, -1.f); fNdcMaxY = min(fNdcMaxY, 1.f);
+        }
+
+        // NDC -> ȼ -> Ÿ(ȭ y Ʒ )
+        tBounds.iTileX0 = min(uint32_t((fNdcMinX * 0.5f + 0.5f) * fWidth * fInvTile), m_iNumTilesX - 1);
+        tBounds.iTileX1 = min(uint32_t((fNdcMaxX * 0.5f + 0.5f) * fWidth * fInvTile), m_iNumTilesX - 1);
+        tBounds.iTileY0 = min(uint32_t((0.5f - fNdcMaxY * 0.5f) * fHeight * fInvTile), m_iNumTilesY - 1);
+        tBounds.iTileY1 = min(uint32_t((0.5f - fNdcMinY * 0.5f) * fHeight * fInvTile), m_iNumTilesY - 1);
+        tBounds.iSlice0 = Compute_Slice(max(fMinZ, m_tDesc.fNear));
+        tBounds.iSlice1 = Compute_Slice(min(fMaxZ, m_tDesc.fFar));
+
+        for (uint32_t s = tBounds.iSlice0; s <= tBounds.iSlice1; ++s)
+            for (uint32_t y = tBounds.iTileY0; y <= tBounds.iTileY1; ++y)
+                for (uint32_t x = tBounds.iTileX0; x <= tBounds.iTileX1; ++x)
+                    ++m_Ranges[(s * m_iNumTilesY + y) * m_iNumTilesX + x].iCount;
+    }
+
+    // 3.   Ŭͺ  ġ Ȯ
+    uint32_t iTotal = 0;
+    for (auto& tRange : m_Ranges)
+    {
+        tRange.iOffset = iTotal;
+        iTotal += tRange.iCount;
+        tRange.iCount = 0;
+    }
+
+    m_Indices.resize(iTotal);
+
+    // 4. ä(Į   -> ̴   ռ)
+    for (uint32_t i = 0; i < iNumDecals; ++i)
+    {
+        const CLUSTER_BOUNDS& tBounds = m_Bounds[i];
+        if (tBounds.iTileX0 > tBounds.iTileX1)
+            continue;
+
+        for (uint32_t s = tBounds.iSlice0; s <= tBounds.iSlice1; ++s)
+            for (uint32_t y = tBounds.iTileY0; y <= tBounds.iTileY1; ++y)
+                for (uint32_t x = tBounds.iTileX0; x <= tBounds.iTileX1; ++x)
+                {
+                    CLUSTER_RANGE& tRange = m_Ranges[(s * m_iNumTilesY + y) * m_iNumTilesX + x];
+                    m_Indices[tRange.iOffset + tRange.iCount++] = m_DecalIndex[i];
+                }
+    }
+}
+
+uint32_t CDecal_ClusterBinner::Compute_Slice(float fViewZ) const
+{
+    float fSlice = logf(fViewZ) * m_fSliceScale + m_fSliceBias;
+    fSlice = clamp(fSlice, 0.f, float(m_tDesc.iNumSlices - 1));
+
+    return uint32_t(fSlice);
+}
+
+}
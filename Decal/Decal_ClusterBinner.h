@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// /DirectXMath/HRESULT  ʴ  ( ġũ ״ )
+//   켱 float[16](_float4x4  ޸ ġ,   * ) 
+namespace Client
+{
+
+// Į OBB ȭ Ÿ x  ̽(Ŭ) зϴ CPU  
+// Ǯũ   ȼ /븻   а ش Ŭ Į ȸϱ 
+// Į ʹ SoA ؼ 1 ( ȯ,  ) Ϸ ڵ ȭ  ǵ 
+class CDecal_ClusterBinner final
+{
+public:
+	struct DESC
+	{
+		uint32_t	iScreenWidth = {};
+		uint32_t	iScreenHeight = {};
+		uint32_t	iTileSize = { 32 };
+		uint32_t	iNumSlices = { 16 };
+		float		fNear = { 0.1f };
+		float		fFar = { 1000.f };
+	};
+
+	// ̴ Buffer<uint2> g_ClusterRanges ̾ƿ ġ
+	struct CLUSTER_RANGE
+	{
+		uint32_t	iOffset;
+		uint32_t	iCount;
+	};
+
+	// (Ÿ X, Ÿ Y, ̽, Ÿ ũ), ̴ g_vClusterDims
+	struct CLUSTER_DIMS
+	{
+		uint32_t	x, y, z, w;
+	};
+
+public:
+	// ߸ ̸ false
+	bool								Setup(const DESC& tDesc);
+	void								Clear();
+	// iDecalIndex g_DecalInstances  ε, pWorld  켱 4x4
+	void								Add_Decal(uint32_t iDecalIndex, const float* pWorld, float fBoxSizeX, float fBoxSizeY, float fBoxSizeZ);
+	void								Bin(const float* pView, const float* pProj);
+
+	const std::vector<CLUSTER_RANGE>&	Get_ClusterRanges() const { return m_Ranges; }
+	const std::vector<uint32_t>&		Get_DecalIndices() const { return m_Indices; }
+	uint32_t							Get_NumClusters() const { return m_iNumTilesX * m_iNumTilesY * m_tDesc.iNumSlices; }
+	uint32_t							Get_NumDecals() const { return (uint32_t)m_DecalIndex.size(); }
+	CLUSTER_DIMS						Get_ClusterDims() const { return { m_iNumTilesX, m_iNumTilesY, m_tDesc.iNumSlices, m_tDesc.iTileSize }; }
+	// slice = log(viewZ) * Scale + Bias, ̴ g_vClusterZParams
+	float								Get_SliceScale() const { return m_fSliceScale; }
+	float								Get_SliceBias() const { return m_fSliceBias; }
+	// ̴  (׽Ʈ/׿)
+	uint32_t							Compute_Slice(float fViewZ) const;
+
+private:
+	DESC								m_tDesc = {};
+	uint32_t							m_iNumTilesX = {};
+	uint32_t							m_iNumTilesY = {};
+	float								m_fSliceScale = {};
+	float								m_fSliceBias = {};
+
+	// Į Է(SoA): ߽ɰ  ũⰡ   
+	std::vector<uint32_t>				m_DecalIndex;
+	std::vector<float>					m_CenterX, m_CenterY, m_CenterZ;
+	std::vector<float>					m_AxisX[3], m_AxisY[3], m_AxisZ[3];
+
+	// 1  (SoA):   AABB
+	std::vector<float>					m_ViewMinX, m_ViewMaxX, m_ViewMinY, m_ViewMaxY, m_ViewMinZ, m_ViewMaxZ;
+
+	// Į Ŭ , ȭ ̸ iTileX0 > iTileX1
+	struct CLUSTER_BOUNDS
+	{
+		uint32_t	iTileX0, iTileX1, iTileY0, iTileY1, iSlice0, iSlice1;
+	};
+	std::vector<CLUSTER_BOUNDS>			m_Bounds;
+
+	std::vector<CLUSTER_RANGE>			m_Ranges;
+	std::vector<uint32_t>				m_Indices;
+};
+
+}
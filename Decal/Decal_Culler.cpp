@@ -0,0 +1,273 @@
+#include "Decal_Culler.h"
+
+// x86/x64 Ϸ ɼ(/arch:AVX, -mavx)  AVX θ 
+// MSVC intrinsic ״ ϰ, GCC/Clang ش Լ target("avx") 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DECAL_CULLER_AVX
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DECAL_TARGET_AVX
+#else
+#include <cpuid.h>
+#define DECAL_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+namespace
+{
+    //  1Ʈ ġ(iMask != 0)
+    _uint Find_LowestBit(_uint iMask)
+    {
+#if defined(_MSC_VER)
+        unsigned long iBit = 0;
+        _BitScanForward(&iBit, iMask);
+        return _uint(iBit);
+#else
+        return _uint(__builtin_ctz(iMask));
+#endif
+    }
+}
+
+void CDecal_Culler::Clear()
+{
+    m_CenterX.clear(); m_CenterY.clear(); m_CenterZ.clear();
+    m_Radius.clear();
+    for (_uint i = 0; i < 3; ++i)
+    {
+        m_AxisX[i].clear(); m_AxisY[i].clear(); m_AxisZ[i].clear();
+    }
+    m_Visible.clear();
+}
+
+void CDecal_Culler::Reserve(_uint iNumBoxes)
+{
+    m_CenterX.reserve(iNumBoxes); m_CenterY.reserve(iNumBoxes); m_CenterZ.reserve(iNumBoxes);
+    m_Radius.reserve(iNumBoxes);
+    for (_uint i = 0; i < 3; ++i)
+    {
+        m_AxisX[i].reserve(iNumBoxes); m_AxisY[i].reserve(iNumBoxes); m_AxisZ[i].reserve(iNumBoxes);
+    }
+    m_Visible.reserve(iNumBoxes);
+}
+
+_uint CDecal_Culler::Add_Box(const _float4x4& WorldMatrix, const _float3& vBoxSize)
+{
+    // ̴ ڽ (|local| <= vBoxSize * 0.5)  ũ
+    const _float fHalf[3] = { vBoxSize.x * 0.5f, vBoxSize.y * 0.5f, vBoxSize.z * 0.5f };
+
+    m_CenterX.push_back(WorldMatrix._41);
+    m_CenterY.push_back(WorldMatrix._42);
+    m_CenterZ.push_back(WorldMatrix._43);
+
+    // 豸:  (   )̸  밢  = sqrt(|a_k|)
+    _float fRadiusSq = 0.f;
+    for (_uint i = 0; i < 3; ++i)
+    {
+        _float fX = WorldMatrix.m[i][0] * fHalf[i];
+        _float fY = WorldMatrix.m[i][1] * fHalf[i];
+        _float fZ = WorldMatrix.m[i][2] * fHalf[i];
+
+        m_AxisX[i].push_back(fX);
+        m_AxisY[i].push_back(fY);
+        m_AxisZ[i].push_back(fZ);
+        fRadiusSq += fX * fX + fY * fY + fZ * fZ;
+    }
+    m_Radius.push_back(sqrtf(fRadiusSq));
+
+    return (_uint)m_CenterX.size() - 1;
+}
+
+void CDecal_Culler::Cull(const _float4x4& ViewProjMatrix, const _float3& vCamPos, _float fMaxDistance)
+{
+    m_Visible.clear();
+
+    Extract_Planes(ViewProjMatrix);
+
+    const _uint iNumBoxes = Get_NumBoxes();
+    _uint i = 0;
+
+    if (m_bUseSIMD && Is_AVXSupported())
+        i = Cull_AVX(vCamPos, fMaxDistance);
+
+    // (Ǵ AVX  ȯ ü)
+    for (; i < iNumBoxes; ++i)
+    {
+        if (Is_Visible_Scalar(i, vCamPos, fMaxDistance))
+            m_Visible.push_back(i);
+    }
+}
+
+_bool CDecal_Culler::Is_AVXSupported()
+{
+#if defined(DECAL_CULLER_AVX)
+    // CPU AVX Ʈ + OS YMM ¸ ϴ(OSXSAVE, XCR0 Ʈ 1/2) Ȯ,   ˻
+    static const _bool bSupported = []()
+        {
+            _uint iECX = 0;
+#if defined(_MSC_VER)
+            _int CPUInfo[4] = {};
+            __cpuid(CPUInfo, 1);
+            iECX = _uint(CPUInfo[2]);
+#else
+            _uint iEAX = 0, iEBX = 0, iEDX = 0;
+            if (!__get_cpuid(1, &iEAX, &iEBX, &iECX, &iEDX))
+                return false;
+#endif
+            const _uint iOSXSAVE = 1u << 27, iAVX = 1u << 28;
+            if ((iECX & (iOSXSAVE | iAVX)) != (iOSXSAVE | iAVX))
+                return false;
+
+#if defined(_MSC_VER)
+            unsigned long long iXCR0 = _xgetbv(0);
+#else
+            _uint iLow = 0, iHigh = 0;
+            __asm__ volatile("xgetbv" : "=a"(iLow), "=d"(iHigh) : "c"(0));
+            unsigned long long iXCR0 = (unsigned long long)iHigh << 32 | iLow;
+#endif
+            return (iXCR0 & 0x6) == 0x6;
+        }();
+
+    return bSupported;
+#else
+    return false;
+#endif
+}
+
+#if defined(DECAL_CULLER_AVX)
+DECAL_TARGET_AVX _uint CDecal_Culler::Cull_AVX(const _float3& vCamPos, _float fMaxDistance)
+{
+    const _uint iNumBoxes = Get_NumBoxes();
+    _uint i = 0;
+
+    // 鸶 d = nc + w, r = |na_k|, d < -r ̸  ٱ
+    const __m256 vSignMask = _mm256_set1_ps(-0.f);
+    const __m256 vCamX = _mm256_set1_ps(vCamPos.x);
+    const __m256 vCamY = _mm256_set1_ps(vCamPos.y);
+    const __m256 vCamZ = _mm256_set1_ps(vCamPos.z);
+    const __m256 vMaxDist = _mm256_set1_ps(fMaxDistance);
+    const _bool bUseDistance = fMaxDistance > 0.f;
+
+    for (; i + 8 <= iNumBoxes; i += 8)
+    {
+        __m256 vCX = _mm256_loadu_ps(&m_CenterX[i]);
+        __m256 vCY = _mm256_loadu_ps(&m_CenterY[i]);
+        __m256 vCZ = _mm256_loadu_ps(&m_CenterZ[i]);
+
+        // Ÿ ø(豸 ): |c - cam| - r <= max  <=>  |c - cam| <= (max + r)
+        __m256 vInside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        if (bUseDistance)
+        {
+            __m256 vDX = _mm256_sub_ps(vCX, vCamX);
+            __m256 vDY = _mm256_sub_ps(vCY, vCamY);
+            __m256 vDZ = _mm256_sub_ps(vCZ, vCamZ);
+            __m256 vDistSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vDX, vDX), _mm256_mul_ps(vDY, vDY)), _mm256_mul_ps(vDZ, vDZ));
+            __m256 vLimit = _mm256_add_ps(vMaxDist, _mm256_loadu_ps(&m_Radius[i]));
+            vInside = _mm256_cmp_ps(vDistSq, _mm256_mul_ps(vLimit, vLimit), _CMP_LE_OQ);
+        }
+
+        __m256 vAX[3], vAY[3], vAZ[3];
+        for (_uint k = 0; k < 3; ++k)
+        {
+            vAX[k] = _mm256_loadu_ps(&m_AxisX[k][i]);
+            vAY[k] = _mm256_loadu_ps(&m_AxisY[k][i]);
+            vAZ[k] = _mm256_loadu_ps(&m_AxisZ[k][i]);
+        }
+
+        for (_uint p = 0; p < 6; ++p)
+        {
+            const __m256 vNX = _mm256_set1_ps(m_Planes[p].x);
+            const __m256 vNY = _mm256_set1_ps(m_Planes[p].y);
+            const __m256 vNZ = _mm256_set1_ps(m_Planes[p].z);
+
+            __m256 vDist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vNX, vCX), _mm256_mul_ps(vNY, vCY)),
+                _mm256_add_ps(_mm256_mul_ps(vNZ, vCZ), _mm256_set1_ps(m_Planes[p].w)));
+
+            __m256 vRadius = _mm256_setzero_ps();
+            for (_uint k = 0; k < 3; ++k)
+            {
+                __m256 vProj = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vNX, vAX[k]), _mm256_mul_ps(vNY, vAY[k])), _mm256_mul_ps(vNZ, vAZ[k]));
+                vRadius = _mm256_add_ps(vRadius, _mm256_andnot_ps(vSignMask, vProj));
+            }
+
+            vInside = _mm256_and_ps(vInside, _mm256_cmp_ps(_mm256_add_ps(vDist, vRadius), _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+
+        //  θ ؼ 
+        _uint iMask = _uint(_mm256_movemask_ps(vInside));
+        while (iMask)
+        {
+            m_Visible.push_back(i + Find_LowestBit(iMask));
+            iMask &= iMask - 1;
+        }
+    }
+
+    //  SSE( VEX) ڵ ư   ȯ  
+    _mm256_zeroupper();
+
+    return i;
+}
+#else
+_uint CDecal_Culler::Cull_AVX(const _float3& vCamPos, _float fMaxDistance)
+{
+    return 0;
+}
+#endif
+
+void CDecal_Culler::Extract_Planes(const _float4x4& M)
+{
+    //   Ģ(v * M)    , D3D  z  [0, 1]
+    const _float4 vCol1 = _float4(M._11, M._21, M._31, M._41);
+    const _float4 vCol2 = _float4(M._12, M._22, M._32, M._42);
+    const _float4 vCol3 = _float4(M._13, M._23, M._33, M._43);
+    const _float4 vCol4 = _float4(M._14, M._24, M._34, M._44);
+
+    const _float4 vPlanes[6] =
+    {
+        _float4(vCol4.x + vCol1.x, vCol4.y + vCol1.y, vCol4.z + vCol1.z, vCol4.w + vCol1.w),	// Left
+        _float4(vCol4.x - vCol1.x, vCol4.y - vCol1.y, vCol4.z - vCol1.z, vCol4.w - vCol1.w),	// Right
+        _float4(vCol4.x + vCol2.x, vCol4.y + vCol2.y, vCol4.z + vCol2.z, vCol4.w + vCol2.w),	// Bottom
+        _float4(vCol4.x - vCol2.x, vCol4.y - vCol2.y, vCol4.z - vCol2.z, vCol4.w - vCol2.w),	// Top
+        vCol3,																					// Near
+        _float4(vCol4.x - vCol3.x, vCol4.y - vCol3.y, vCol4.z - vCol3.z, vCol4.w - vCol3.w),	// Far
+    };
+
+    // XMPlaneNormalize   ̷ 
+    for (_uint i = 0; i < 6; ++i)
+    {
+        const _float4& vPlane = vPlanes[i];
+        _float fLength = sqrtf(vPlane.x * vPlane.x + vPlane.y * vPlane.y + vPlane.z * vPlane.z);
+        _float fInvLength = fLength > 0.f ? 1.f / fLength : 0.f;
+
+        m_Planes[i] = _float4(vPlane.x * fInvLength, vPlane.y * fInvLength, vPlane.z * fInvLength, vPlane.w * fInvLength);
+    }
+}
+
+_bool CDecal_Culler::Is_Visible_Scalar(_uint iIndex, const _float3& vCamPos, _float fMaxDistance) const
+{
+    _float fCX = m_CenterX[iIndex], fCY = m_CenterY[iIndex], fCZ = m_CenterZ[iIndex];
+
+    // Ÿ ø(豸 , AVX ο  )
+    if (fMaxDistance > 0.f)
+    {
+        _float fDX = fCX - vCamPos.x, fDY = fCY - vCamPos.y, fDZ = fCZ - vCamPos.z;
+        _float fLimit = fMaxDistance + m_Radius[iIndex];
+        if (fDX * fDX + fDY * fDY + fDZ * fDZ > fLimit * fLimit)
+            return false;
+    }
+
+    for (_uint p = 0; p < 6; ++p)
+    {
+        const _float4& vPlane = m_Planes[p];
+
+        _float fDist = vPlane.x * fCX + vPlane.y * fCY + vPlane.z * fCZ + vPlane.w;
+        _float fRadius = 0.f;
+        for (_uint k = 0; k < 3; ++k)
+            fRadius += fabsf(vPlane.x * m_AxisX[k][iIndex] + vPlane.y * m_AxisY[k][iIndex] + vPlane.z * m_AxisZ[k][iIndex]);
+
+        if (fDist + fRadius < 0.f)
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Client_Defines.h"
+
+BEGIN(Client)
+
+// Į OBB ü + ִ Ÿ ø
+// ڽ SoA ϰ AVX 8 ؼ  ѱ  ε  
+// AVX δ /arch ɼǰ ϰ ϰ   CPU/OS  Ȯؼ (̸   Į )
+class CDecal_Culler final
+{
+public:
+	void					Clear();
+	void					Reserve(_uint iNumBoxes);
+	// ȯ ڽ ε(= ߰ )
+	_uint					Add_Box(const _float4x4& WorldMatrix, const _float3& vBoxSize);
+
+	// fMaxDistance: ī޶󿡼 ڽ 豸 Ÿ (0 ϸ Ÿ ø  )
+	void					Cull(const _float4x4& ViewProjMatrix, const _float3& vCamPos, _float fMaxDistance);
+
+	const vector<_uint>&	Get_Visible() const { return m_Visible; }
+	_uint					Get_NumBoxes() const { return (_uint)m_CenterX.size(); }
+
+	// /׿: false AVX ص Į  
+	void					Set_UseSIMD(_bool bUseSIMD) { m_bUseSIMD = bUseSIMD; }
+	static _bool			Is_AVXSupported();
+
+private:
+	void					Extract_Planes(const _float4x4& ViewProjMatrix);
+	_bool					Is_Visible_Scalar(_uint iIndex, const _float3& vCamPos, _float fMaxDistance) const;
+	// 8  ó ڽ  ȯ( Į)
+	_uint					Cull_AVX(const _float3& vCamPos, _float fMaxDistance);
+
+private:
+	// ڽ ߽ɰ  ũⰡ   (SoA), 豸 ( 밢 )
+	vector<_float>			m_CenterX, m_CenterY, m_CenterZ;
+	vector<_float>			m_Radius;
+	vector<_float>			m_AxisX[3], m_AxisY[3], m_AxisZ[3];
+
+	_float4					m_Planes[6] = {};	//  ,  ȭ,  
+	vector<_uint>			m_Visible;
+	_bool					m_bUseSIMD = { true };
+};
+
+END
@@ -0,0 +1,74 @@
+#include "Decal_InstancePacker.h"
+
+void CDecal_InstancePacker::Clear()
+{
+    // 뷮 ؼ   Ҵ 
+    m_Pending.clear();
+    m_Submitted.clear();
+    m_Packed.clear();
+    m_Batches.clear();
+}
+
+void CDecal_InstancePacker::Add(_uint iMaterialID, const DECAL_INSTANCE& tInstance)
+{
+    m_Pending.push_back({ iMaterialID, (_uint)m_Submitted.size() });
+    m_Submitted.push_back(tInstance);
+}
+
+void CDecal_InstancePacker::Add(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fElapsedTime, _float fLifeTime)
+{
+    DECAL_INSTANCE tInstance = {};
+
+    // ̴  ü row_major Ǿ Ƿ ġ  ״ 
+    XMStoreFloat4x4(&tInstance.WorldMatrix, WorldMatrix);
+    XMStoreFloat4x4(&tInstance.WorldMatrixInv, XMMatrixInverse(nullptr, WorldMatrix));
+    tInstance.vBoxSize = _float4(vBoxSize.x, vBoxSize.y, vBoxSize.z, 0.f);
+    tInstance.vColor = vColor;
+    tInstance.fElapsedTime = fElapsedTime;
+    tInstance.fLifeTime = fLifeTime;
+
+    Add(iMaterialID, tInstance);
+}
+
+void CDecal_InstancePacker::Pack(const vector<_uint>* pVisible, _uint iNumCulled)
+{
+    m_Packed.clear();
+    m_Batches.clear();
+
+    if (m_Pending.empty())
+        return;
+
+    if (pVisible)
+    {
+        m_VisibleMask.assign(m_Submitted.size(), true);
+        fill_n(m_VisibleMask.begin(), min<size_t>(iNumCulled, m_VisibleMask.size()), false);
+
+        for (_uint iIndex : *pVisible)
+        {
+            if (iIndex < m_VisibleMask.size())
+                m_VisibleMask[iIndex] = true;
+        }
+    }
+
+    sort(m_Pending.begin(), m_Pending.end(), [](const PENDING& lhs, const PENDING& rhs)
+        {
+            if (lhs.iMaterialID != rhs.iMaterialID)
+                return lhs.iMaterialID < rhs.iMaterialID;
+            return lhs.iOrder < rhs.iOrder;
+        });
+
+    m_Packed.reserve(m_Pending.size());
+
+    for (auto& tPending : m_Pending)
+    {
+        if (pVisible && !m_VisibleMask[tPending.iOrder])
+            continue;
+
+        //  ٲ  ġ 
+        if (m_Batches.empty() || m_Batches.back().iMaterialID != tPending.iMaterialID)
+            m_Batches.push_back({ tPending.iMaterialID, (_uint)m_Packed.size(), 0 });
+
+        m_Packed.push_back(m_Submitted[tPending.iOrder]);
+        ++m_Batches.back().iNumInstances;
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Client_Defines.h"
+
+BEGIN(Client)
+
+// Ȱ Į   ϳ νϽ 迭 ϴ CPU  Ŀ
+// ̽  Ƿ GPU ̵ (ε/ο CDecal_Batch )
+class CDecal_InstancePacker final
+{
+public:
+	// Shader_Effect_Decal.hlsl DECAL_INSTANCE ̾ƿ ġ(16Ʈ )
+	struct DECAL_INSTANCE
+	{
+		_float4x4	WorldMatrix;
+		_float4x4	WorldMatrixInv;
+		_float4		vBoxSize;
+		_float4		vColor;
+		_float		fElapsedTime;
+		_float		fLifeTime;
+		_float2		vPadding;
+	};
+	static_assert(sizeof(DECAL_INSTANCE) % 16 == 0, "DECAL_INSTANCE must be 16-byte aligned for StructuredBuffer");
+
+	//  ϳ ο  
+	struct BATCH
+	{
+		_uint		iMaterialID = {};
+		_uint		iStartInstance = {};
+		_uint		iNumInstances = {};
+	};
+
+public:
+	void							Clear();
+	void							Add(_uint iMaterialID, const DECAL_INSTANCE& tInstance);
+	//  ķκ ı ä ߰
+	void							Add(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fElapsedTime, _float fLifeTime);
+
+	//  ID     ġ 
+	// pVisible   iNumCulled   (  ε, CDecal_Culler )  ͸ 
+	// ø Ŀ  Į(ε >= iNumCulled)  ʾǷ ̴  
+	void							Pack(const vector<_uint>* pVisible = nullptr, _uint iNumCulled = 0);
+
+	const vector<DECAL_INSTANCE>&	Get_Instances() const { return m_Packed; }
+	const vector<BATCH>&			Get_Batches() const { return m_Batches; }
+	_uint							Get_NumPending() const { return (_uint)m_Pending.size(); }
+	const vector<DECAL_INSTANCE>&	Get_Submitted() const { return m_Submitted; }
+
+private:
+	struct PENDING
+	{
+		_uint			iMaterialID;
+		_uint			iOrder;		//      ( )
+	};
+
+	vector<PENDING>					m_Pending;
+	vector<DECAL_INSTANCE>			m_Submitted;
+	vector<DECAL_INSTANCE>			m_Packed;
+	vector<BATCH>					m_Batches;
+	vector<_bool>					m_VisibleMask;
+};
+
+END
@@ -0,0 +1,314 @@
+#include "Decal_Permutation.h"
+#include <filesystem>
+
+HRESULT CDecal_Permutation::Collect_FromJson(const json& jData)
+{
+    // Emitter д Ͱ  迭 Į ŸԸ
+    for (const char* pKey : { "ChildEffect", "GameObjects" })
+    {
+        if (!jData.contains(pKey) || !jData[pKey].is_array())
+            continue;
+
+        for (auto& j : jData[pKey])
+        {
+            if (!j.contains("szPrototypeTag"))
+                continue;
+
+            if (j["szPrototypeTag"].get<_string>().find("Decal") == _string::npos)
+                continue;
+
+            m_Manifest.insert(Flags_FromJson(j));
+        }
+    }
+
+    return S_OK;
+}
+
+HRESULT CDecal_Permutation::Collect_FromFile(const _wstring& wsFilePath)
+{
+    ifstream ifs(filesystem::path(wsFilePath), ios::in);
+    if (!ifs.is_open())
+        return E_FAIL;
+
+    json jData;
+    ifs >> jData;
+    ifs.close();
+
+    return Collect_FromJson(jData);
+}
+
+HRESULT CDecal_Permutation::Build_Cache(CCompiler* pCompiler, const _wstring& wsShaderPath, const _wstring& wsCachePath)
+{
+    if (!pCompiler)
+        return E_FAIL;
+
+    m_iSourceHash = Hash_Source(wsShaderPath, pCompiler->Get_OptionsHash());
+    m_Blobs.clear();
+
+    for (_uint iFlags : m_Manifest)
+    {
+        vector<_byte> Blob;
+        if (FAILED(pCompiler->Compile(wsShaderPath, Make_Macros(iFlags), &Blob)))
+            return E_FAIL;
+
+        m_Blobs.emplace(Make_CacheKey(iFlags, m_iSourceHash), move(Blob));
+    }
+
+    ofstream ofs(filesystem::path(wsCachePath), ios::binary);
+    if (!ofs.is_open())
+        return E_FAIL;
+
+    _uint iNumEntries = (_uint)m_Blobs.size();
+    ofs.write(reinterpret_cast<const char*>(&CACHE_MAGIC), sizeof(_uint));
+    ofs.write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(_uint));
+    ofs.write(reinterpret_cast<const char*>(&m_iSourceHash), sizeof(_uint64));
+    ofs.write(reinterpret_cast<const char*>(&iNumEntries), sizeof(_uint));
+
+    for (auto& [strKey, Blob] : m_Blobs)
+    {
+        _uint iKeyLength = (_uint)strKey.size();
+        _uint iBlobSize = (_uint)Blob.size();
+
+        ofs.write(reinterpret_cast<const char*>(&iKeyLength), sizeof(_uint));
+        ofs.write(strKey.data(), iKeyLength);
+        ofs.write(reinterpret_cast<const char*>(&iBlobSize), sizeof(_uint));
+        ofs.write(reinterpret_cast<const char*>(Blob.data()), iBlobSize);
+    }
+
+    return ofs.good() ? S_OK : E_FAIL;
+}
+
+HRESULT CDecal_Permutation::Load_Cache(const CCompiler* pCompiler, const _wstring& wsShaderPath, const _wstring& wsCachePath)
+{
+    m_Blobs.clear();
+
+    if (!pCompiler)
+        return E_FAIL;
+
+    ifstream ifs(filesystem::path(wsCachePath), ios::binary | ios::ate);
+    if (!ifs.is_open())
+        return E_FAIL;
+
+    //  ʵ    ũ (ջ ĳ÷ Ŵ Ҵ  ʵ)
+    const _uint64 iFileSize = _uint64(ifs.tellg());
+    ifs.seekg(0, ios::beg);
+
+    auto Remaining = [&]() -> _uint64 { return iFileSize - _uint64(ifs.tellg()); };
+
+    _uint iMagic = 0, iVersion = 0, iNumEntries = 0;
+    _uint64 iSourceHash = 0;
+
+    ifs.read(reinterpret_cast<char*>(&iMagic), sizeof(_uint));
+    ifs.read(reinterpret_cast<char*>(&iVersion), sizeof(_uint));
+    ifs.read(reinterpret_cast<char*>(&iSourceHash), sizeof(_uint64));
+    ifs.read(reinterpret_cast<char*>(&iNumEntries), sizeof(_uint));
+
+    if (!ifs || iMagic != CACHE_MAGIC || iVersion != CACHE_VERSION)
+        return E_FAIL;
+
+    // ׸ ּ ũ(Ű  +  ũ ʵ)
+    if (_uint64(iNumEntries) * sizeof(_uint) * 2 > Remaining())
+        return E_FAIL;
+
+    // ̴ /include/  ĳ   ٲ
+    if (iSourceHash != Hash_Source(wsShaderPath, pCompiler->Get_OptionsHash()))
+        return E_FAIL;
+
+    for (_uint i = 0; i < iNumEntries; ++i)
+    {
+        _uint iKeyLength = 0, iBlobSize = 0;
+
+        ifs.read(reinterpret_cast<char*>(&iKeyLength), sizeof(_uint));
+        if (!ifs || iKeyLength > MAX_KEY_LENGTH || iKeyLength > Remaining())
+        {
+            m_Blobs.clear();
+            return E_FAIL;
+        }
+
+        _string strKey(iKeyLength, '\0');
+        ifs.read(strKey.data(), iKeyLength);
+
+        ifs.read(reinterpret_cast<char*>(&iBlobSize), sizeof(_uint));
+        if (!ifs || iBlobSize > Remaining())
+        {
+            m_Blobs.clear();
+            return E_FAIL;
+        }
+
+        vector<_byte> Blob(iBlobSize);
+        ifs.read(reinterpret_cast<char*>(Blob.data()), iBlobSize);
+
+        if (!ifs)
+        {
+            m_Blobs.clear();
+            return E_FAIL;
+        }
+
+        m_Blobs.emplace(move(strKey), move(Blob));
+    }
+
+    m_iSourceHash = iSourceHash;
+
+    return S_OK;
+}
+
+const vector<_byte>* CDecal_Permutation::Find_Blob(_uint iFlags) const
+{
+    auto iter = m_Blobs.find(Make_CacheKey(iFlags, m_iSourceHash));
+    if (iter == m_Blobs.end())
+        return nullptr;
+
+    return &iter->second;
+}
+
+_uint CDecal_Permutation::Flags_FromJson(const json& j)
+{
+    _uint iFlags = 0;
+
+    if (j.value("bUseMaskTexture", false))
+        iFlags |= FEATURE_MASK;
+    if (j.value("bUseColor", false))
+        iFlags |= FEATURE_COLOR;
+    if (j.value("bUseAtlas_Diffuse", false))
+        iFlags |= FEATURE_ATLAS_DIFFUSE;
+    if (j.value("bUseAtlas_Mask", false))
+        iFlags |= FEATURE_ATLAS_MASK;
+    if (j.value("bUseUVAnimation", false))
+        iFlags |= FEATURE_UV_ANIMATION;
+
+    return iFlags;
+}
+
+vector<CDecal_Permutation::MACRO> CDecal_Permutation::Make_Macros(_uint iFlags)
+{
+    // ̴ DECAL_USE_*  FEATURE Ʈ  ġ
+    static const _char* pFeatureNames[FEATURE_END] =
+    {
+        "DECAL_USE_MASK",
+        "DECAL_USE_COLOR",
+        "DECAL_USE_ATLAS_DIFFUSE",
+        "DECAL_USE_ATLAS_MASK",
+        "DECAL_USE_UV_ANIMATION",
+    };
+
+    vector<MACRO> Macros;
+    Macros.push_back({ "DECAL_PERMUTATION", "1" });
+
+    for (_uint i = 0; i < FEATURE_END; ++i)
+        Macros.push_back({ pFeatureNames[i], (iFlags & (1 << i)) ? "1" : "0" });
+
+    return Macros;
+}
+
+_string CDecal_Permutation::Make_CacheKey(_uint iFlags, _uint64 iSourceHash)
+{
+    _char szKey[64] = {};
+    snprintf(szKey, sizeof(szKey), "DECAL_%02X_%016llX", iFlags, static_cast<unsigned long long>(iSourceHash));
+
+    return szKey;
+}
+
+_uint64 CDecal_Permutation::Hash_File(const _wstring& wsFilePath)
+{
+    ifstream ifs(filesystem::path(wsFilePath), ios::binary);
+    if (!ifs.is_open())
+        return 0;
+
+    // FNV-1a 64
+    _uint64 iHash = 14695981039346656037ull;
+
+    char szBuffer[4096];
+    while (ifs.read(szBuffer, sizeof(szBuffer)) || ifs.gcount() > 0)
+    {
+        streamsize iCount = ifs.gcount();
+        for (streamsize i = 0; i < iCount; ++i)
+        {
+            iHash ^= static_cast<_ubyte>(szBuffer[i]);
+            iHash *= 1099511628211ull;
+        }
+    }
+
+    return iHash;
+}
+
+_uint64 CDecal_Permutation::Hash_Source(const _wstring& wsShaderPath, _uint64 iOptionsHash)
+{
+    // FNV-1a 64
+    _uint64 iHash = 14695981039346656037ull;
+
+    set<_wstring> Visited;
+    Hash_SourceFile(wsShaderPath, Visited, &iHash);
+
+    for (_uint i = 0; i < sizeof(_uint64); ++i)
+    {
+        iHash ^= (iOptionsHash >> (i * 8)) & 0xFF;
+        iHash *= 1099511628211ull;
+    }
+
+    return iHash;
+}
+
+void CDecal_Permutation::Hash_SourceFile(const _wstring& wsFilePath, set<_wstring>& Visited, _uint64* pHash)
+{
+    if (!Visited.insert(wsFilePath).second)
+        return;
+
+    auto Hash_Bytes = [pHash](const char* pData, size_t iSize)
+    {
+        for (size_t i = 0; i < iSize; ++i)
+        {
+            *pHash ^= static_cast<_ubyte>(pData[i]);
+            *pHash *= 1099511628211ull;
+        }
+    };
+
+    ifstream ifs(filesystem::path(wsFilePath), ios::binary);
+    if (!ifs.is_open())
+    {
+        //  include ̸ ؽÿ ܼ ߿  Ű ٲ
+        Hash_Bytes("<missing>", 9);
+        return;
+    }
+
+    _string strSource((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    Hash_Bytes(strSource.data(), strSource.size());
+
+    // D3D_COMPILE_STANDARD_FILE_INCLUDE    ͸  "..." include 
+    _wstring wsDirectory;
+    size_t iSlash = wsFilePath.find_last_of(L"/\\");
+    if (iSlash != _wstring::npos)
+        wsDirectory = wsFilePath.substr(0, iSlash + 1);
+
+    size_t iPos = 0;
+    while ((iPos = strSource.find("#include", iPos)) != _string::npos)
+    {
+        iPos += 8;
+
+        size_t iLineEnd = strSource.find('\n', iPos);
+        size_t iOpen = strSource.find('"', iPos);
+        if (iOpen == _string::npos || iOpen > iLineEnd)
+            continue;
+
+        size_t iClose = strSource.find('"', iOpen + 1);
+        if (iClose == _string::npos || iClose > iLineEnd)
+            continue;
+
+        _string strName = strSource.substr(iOpen + 1, iClose - iOpen - 1);
+        Hash_Bytes(strName.data(), strName.size());
+
+        Hash_SourceFile(wsDirectory + _wstring(strName.begin(), strName.end()), Visited, pHash);
+    }
+}
+
+CDecal_Permutation* CDecal_Permutation::Create()
+{
+    return new CDecal_Permutation();
+}
+
+void CDecal_Permutation::Free()
+{
+    __super::Free();
+
+    m_Blobs.clear();
+    m_Manifest.clear();
+}
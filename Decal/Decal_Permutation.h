@@ -0,0 +1,89 @@
+#pragma once
+#include "Client_Defines.h"
+#include "Base.h"
+
+BEGIN(Client)
+
+// Į ̴  ÷׸  Ÿ define ٲ ۹̼ 
+// 1. : Ʈ JSON   ÷ ո  Ŵ佺Ʈ 
+// 2. : պ  Ű  ĳ Ϸ 
+// 3. Ÿ: ĳø а CEffect_Decal  ÷׷ ش  
+class CDecal_Permutation final : public CBase
+{
+public:
+	enum FEATURE
+	{
+		FEATURE_MASK			= 1 << 0,
+		FEATURE_COLOR			= 1 << 1,
+		FEATURE_ATLAS_DIFFUSE	= 1 << 2,
+		FEATURE_ATLAS_MASK		= 1 << 3,
+		FEATURE_UV_ANIMATION	= 1 << 4,
+		FEATURE_END				= 5
+	};
+
+	struct MACRO
+	{
+		_string		strName;
+		_string		strDefinition;
+	};
+
+	//  Ϸ Ƴ  ֵ и(GPU/Windows SDK  ȯ濡  ü)
+	class CCompiler abstract : public CBase
+	{
+	protected:
+		CCompiler() = default;
+		virtual ~CCompiler() = default;
+
+	public:
+		virtual HRESULT		Compile(const _wstring& wsShaderPath, const vector<MACRO>& Macros, vector<_byte>* pBlob) = 0;
+		// / ÷ó  ӿ  ִ  ؽ(ĳ Ű )
+		virtual _uint64		Get_OptionsHash() const = 0;
+	};
+
+	// D3DCompileFromFile  Decal_Permutation_D3D.h(Windows SDK )
+	class CCompiler_D3D;
+
+private:
+	CDecal_Permutation() = default;
+	virtual ~CDecal_Permutation() = default;
+
+public:
+	// Ʈ JSON   ִ Į Ʈ ÷׸ Ŵ佺Ʈ ߰
+	HRESULT					Collect_FromJson(const json& jData);
+	HRESULT					Collect_FromFile(const _wstring& wsFilePath);
+	const set<_uint>&		Get_Manifest() const { return m_Manifest; }
+
+	// Ŵ佺Ʈ ո ؼ ĳ Ϸ 
+	HRESULT					Build_Cache(CCompiler* pCompiler, const _wstring& wsShaderPath, const _wstring& wsCachePath);
+	// ̴ /include/  ٲų(ؽ ġ)  ջ  ó ->  Ÿ б ̴ 
+	HRESULT					Load_Cache(const CCompiler* pCompiler, const _wstring& wsShaderPath, const _wstring& wsCachePath);
+
+	//  nullptr
+	const vector<_byte>*	Find_Blob(_uint iFlags) const;
+
+public:
+	static _uint			Flags_FromJson(const json& j);
+	static vector<MACRO>	Make_Macros(_uint iFlags);
+	static _string			Make_CacheKey(_uint iFlags, _uint64 iSourceHash);
+	static _uint64			Hash_File(const _wstring& wsFilePath);
+	// ̴  + "..." include (,     ) +   ؽ
+	static _uint64			Hash_Source(const _wstring& wsShaderPath, _uint64 iOptionsHash);
+
+private:
+	static void				Hash_SourceFile(const _wstring& wsFilePath, set<_wstring>& Visited, _uint64* pHash);
+
+private:
+	static constexpr _uint	CACHE_MAGIC = 0x43505044; // "DPPC"
+	static constexpr _uint	CACHE_VERSION = 2;
+	static constexpr _uint	MAX_KEY_LENGTH = 256;
+
+	set<_uint>				m_Manifest;
+	map<_string, vector<_byte>>	m_Blobs;		// ĳ Ű -> ϵ fx 
+	_uint64					m_iSourceHash = {};
+
+public:
+	static CDecal_Permutation* Create();
+	virtual void			Free() override;
+};
+
+END
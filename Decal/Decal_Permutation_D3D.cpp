@@ -0,0 +1,62 @@
+#include "Decal_Permutation_D3D.h"
+#include <d3dcompiler.h>
+
+HRESULT CDecal_Permutation::CCompiler_D3D::Compile(const _wstring& wsShaderPath, const vector<MACRO>& Macros, vector<_byte>* pBlob)
+{
+    if (!pBlob)
+        return E_FAIL;
+
+    // D3D_SHADER_MACRO   迭
+    vector<D3D_SHADER_MACRO> D3DMacros;
+    for (auto& tMacro : Macros)
+        D3DMacros.push_back({ tMacro.strName.c_str(), tMacro.strDefinition.c_str() });
+    D3DMacros.push_back({ nullptr, nullptr });
+
+    ID3DBlob* pCode = nullptr;
+    ID3DBlob* pError = nullptr;
+
+    HRESULT hr = D3DCompileFromFile(wsShaderPath.c_str(), D3DMacros.data(), D3D_COMPILE_STANDARD_FILE_INCLUDE, nullptr, "fx_5_0", Get_CompileFlags(), 0, &pCode, &pError);
+
+    if (FAILED(hr))
+    {
+        if (pError)
+            OutputDebugStringA(static_cast<const _char*>(pError->GetBufferPointer()));
+
+        Safe_Release(pError);
+        Safe_Release(pCode);
+        return E_FAIL;
+    }
+
+    const _byte* pData = static_cast<const _byte*>(pCode->GetBufferPointer());
+    pBlob->assign(pData, pData + pCode->GetBufferSize());
+
+    Safe_Release(pError);
+    Safe_Release(pCode);
+
+    return S_OK;
+}
+
+_uint64 CDecal_Permutation::CCompiler_D3D::Get_OptionsHash() const
+{
+    // ϰ ÷װ   
+    return (_uint64(Get_CompileFlags()) << 32) | 0x50;  // fx_5_0
+}
+
+_uint CDecal_Permutation::CCompiler_D3D::Get_CompileFlags()
+{
+#ifdef _DEBUG
+    return D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+    return D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#endif
+}
+
+CDecal_Permutation::CCompiler_D3D* CDecal_Permutation::CCompiler_D3D::Create()
+{
+    return new CCompiler_D3D();
+}
+
+void CDecal_Permutation::CCompiler_D3D::Free()
+{
+    __super::Free();
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Decal_Permutation.h"
+
+BEGIN(Client)
+
+// D3DCompileFromFile(fx_5_0) 
+// Ŵ佺Ʈ/ĳ (Decal_Permutation.cpp) Windows SDK  ǵ  и
+class CDecal_Permutation::CCompiler_D3D final : public CDecal_Permutation::CCompiler
+{
+private:
+	CCompiler_D3D() = default;
+	virtual ~CCompiler_D3D() = default;
+
+public:
+	virtual HRESULT		Compile(const _wstring& wsShaderPath, const vector<MACRO>& Macros, vector<_byte>* pBlob) override;
+	virtual _uint64		Get_OptionsHash() const override;
+
+private:
+	//   D3DCOMPILE_* ÷
+	static _uint		Get_CompileFlags();
+
+public:
+	static CCompiler_D3D* Create();
+	virtual void		Free() override;
+};
+
+END
@@ -0,0 +1,311 @@
+#include "Decal_Persistent.h"
+#include "Decal_Batch.h"
+
+HRESULT CDecal_Persistent::Initialize(const DESC& tDesc)
+{
+    if (tDesc.iCapacity == 0 || tDesc.fCellSize <= 0.f)
+        return E_FAIL;
+
+    m_tDesc = tDesc;
+    m_Decals.assign(tDesc.iCapacity, {});
+    m_Cells.reserve(tDesc.iCapacity);
+    m_FreeSlots.reserve(tDesc.iCapacity);
+
+    Clear();
+
+    return S_OK;
+}
+
+CDecal_Persistent::ADD_RESULT CDecal_Persistent::Add(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fLifeTime)
+{
+    _float4x4 World;
+    XMStoreFloat4x4(&World, WorldMatrix);
+
+    // ؽ Ű ٸ  ġ ġ(Ǵ NaN)   ƲǷ  
+    if (!Is_CellInRange(_float3(World._41, World._42, World._43)))
+        return ADD_REJECTED;
+
+    // OBB  AABB: ߽ +-  ũ    
+    const _float fHalf[3] = { vBoxSize.x * 0.5f, vBoxSize.y * 0.5f, vBoxSize.z * 0.5f };
+    _float3 vExtent = {};
+    for (_uint i = 0; i < 3; ++i)
+    {
+        vExtent.x += fabsf(World.m[i][0]) * fHalf[i];
+        vExtent.y += fabsf(World.m[i][1]) * fHalf[i];
+        vExtent.z += fabsf(World.m[i][2]) * fHalf[i];
+    }
+
+    _float3 vMin = _float3(World._41 - vExtent.x, World._42 - vExtent.y, World._43 - vExtent.z);
+    _float3 vMax = _float3(World._41 + vExtent.x, World._42 + vExtent.y, World._43 + vExtent.z);
+
+    //     ڸ    
+    _int iOverlap = Find_Overlap(iMaterialID, vMin, vMax);
+    if (iOverlap >= 0)
+    {
+        DECAL& tExisting = m_Decals[iOverlap];
+
+        if (tExisting.fAge < m_tDesc.fRejectAge)
+            return ADD_REJECTED;
+
+        // :  ,    ,    ؼ ü   ڷ
+        tExisting.fAge = 0.f;
+        tExisting.fLifeTime = max(tExisting.fLifeTime, fLifeTime);
+        if (vColor.w > tExisting.vColor.w)
+            tExisting.vColor = vColor;
+
+        Unlink((_uint)iOverlap);
+        Link_Newest((_uint)iOverlap);
+
+        return ADD_MERGED;
+    }
+
+    //       Į ü
+    if (m_FreeSlots.empty())
+        Kill(m_iOldest);
+
+    _uint iSlot = m_FreeSlots.back();
+    m_FreeSlots.pop_back();
+
+    DECAL& tDecal = m_Decals[iSlot];
+    tDecal.WorldMatrix = World;
+    tDecal.vBoxSize = vBoxSize;
+    tDecal.vColor = vColor;
+    tDecal.vAABBMin = vMin;
+    tDecal.vAABBMax = vMax;
+    tDecal.iMaterialID = iMaterialID;
+    tDecal.fAge = 0.f;
+    tDecal.fLifeTime = fLifeTime;
+    tDecal.bAlive = true;
+
+    Insert_Hash(iSlot);
+    Link_Newest(iSlot);
+    ++m_iNumAlive;
+
+    return ADD_INSERTED;
+}
+
+void CDecal_Persistent::Update(_float fTimeDelta)
+{
+    if (m_iNumAlive == 0)
+        return;
+
+    for (_uint i = 0; i < Get_Capacity(); ++i)
+    {
+        DECAL& tDecal = m_Decals[i];
+        if (!tDecal.bAlive)
+            continue;
+
+        tDecal.fAge += fTimeDelta;
+        if (tDecal.fAge >= tDecal.fLifeTime)
+            Kill(i);
+    }
+}
+
+void CDecal_Persistent::Fade_Out_All(_float fDuration)
+{
+    for (auto& tDecal : m_Decals)
+    {
+        if (!tDecal.bAlive)
+            continue;
+
+        // ̴ ̵尡 (fAge / fLifeTime) ̹Ƿ    ä  ð 
+        _float fRemain = tDecal.fLifeTime - tDecal.fAge;
+        if (fRemain <= fDuration)
+            continue;
+
+        _float fRatio = (tDecal.fLifeTime > 0.f) ? tDecal.fAge / tDecal.fLifeTime : 0.f;
+        tDecal.fLifeTime = (fRatio < 1.f) ? fDuration / (1.f - fRatio) : fDuration;
+        tDecal.fAge = fRatio * tDecal.fLifeTime;
+    }
+}
+
+void CDecal_Persistent::Clear()
+{
+    for (auto& tDecal : m_Decals)
+    {
+        tDecal.bAlive = false;
+        tDecal.iOlder = tDecal.iNewer = NO_SLOT;
+    }
+
+    //  Ժ   
+    m_FreeSlots.clear();
+    for (_uint i = Get_Capacity(); i > 0; --i)
+        m_FreeSlots.push_back(i - 1);
+
+    m_Cells.clear();
+    m_iOldest = m_iNewest = NO_SLOT;
+    m_iNumAlive = 0;
+}
+
+void CDecal_Persistent::Submit(CDecal_Batch* pBatch) const
+{
+    if (!pBatch)
+        return;
+
+    for (_uint iSlot = m_iOldest; iSlot != NO_SLOT; iSlot = m_Decals[iSlot].iNewer)
+    {
+        const DECAL& tDecal = m_Decals[iSlot];
+
+        pBatch->Submit(tDecal.iMaterialID, XMLoadFloat4x4(&tDecal.WorldMatrix), tDecal.vBoxSize, tDecal.vColor, tDecal.fAge, tDecal.fLifeTime);
+    }
+}
+
+_uint64 CDecal_Persistent::Make_CellKey(_int iX, _int iY, _int iZ) const
+{
+    //  21Ʈ ŷ
+    const _uint64 iMask = (1ull << 21) - 1;
+
+    return ((_uint64(iX) & iMask) << 42) | ((_uint64(iY) & iMask) << 21) | (_uint64(iZ) & iMask);
+}
+
+_uint64 CDecal_Persistent::Make_CellKey(const _float3& vPos) const
+{
+    return Make_CellKey(_int(floorf(vPos.x / m_tDesc.fCellSize)),
+                        _int(floorf(vPos.y / m_tDesc.fCellSize)),
+                        _int(floorf(vPos.z / m_tDesc.fCellSize)));
+}
+
+_bool CDecal_Persistent::Is_CellInRange(const _float3& vPos) const
+{
+    // NaN 񱳰  false ⼭ ɷ
+    const _float fLimit = _float(MAX_CELL_COORD) * m_tDesc.fCellSize;
+
+    return fabsf(vPos.x) < fLimit && fabsf(vPos.y) < fLimit && fabsf(vPos.z) < fLimit;
+}
+
+void CDecal_Persistent::Insert_Hash(_uint iSlot)
+{
+    const DECAL& tDecal = m_Decals[iSlot];
+
+    m_Cells[Make_CellKey(_float3(tDecal.WorldMatrix._41, tDecal.WorldMatrix._42, tDecal.WorldMatrix._43))].push_back(iSlot);
+}
+
+void CDecal_Persistent::Remove_Hash(_uint iSlot)
+{
+    const DECAL& tDecal = m_Decals[iSlot];
+
+    auto iter = m_Cells.find(Make_CellKey(_float3(tDecal.WorldMatrix._41, tDecal.WorldMatrix._42, tDecal.WorldMatrix._43)));
+    if (iter == m_Cells.end())
+        return;
+
+    auto& Slots = iter->second;
+    auto SlotIter = find(Slots.begin(), Slots.end(), iSlot);
+    if (SlotIter != Slots.end())
+    {
+        *SlotIter = Slots.back();
+        Slots.pop_back();
+    }
+
+    if (Slots.empty())
+        m_Cells.erase(iter);
+}
+
+void CDecal_Persistent::Kill(_uint iSlot)
+{
+    Remove_Hash(iSlot);
+    Unlink(iSlot);
+
+    m_Decals[iSlot].bAlive = false;
+    m_FreeSlots.push_back(iSlot);
+    --m_iNumAlive;
+}
+
+void CDecal_Persistent::Link_Newest(_uint iSlot)
+{
+    DECAL& tDecal = m_Decals[iSlot];
+    tDecal.iOlder = m_iNewest;
+    tDecal.iNewer = NO_SLOT;
+
+    if (m_iNewest != NO_SLOT)
+        m_Decals[m_iNewest].iNewer = iSlot;
+    else
+        m_iOldest = iSlot;
+
+    m_iNewest = iSlot;
+}
+
+void CDecal_Persistent::Unlink(_uint iSlot)
+{
+    DECAL& tDecal = m_Decals[iSlot];
+
+    if (tDecal.iOlder != NO_SLOT)
+        m_Decals[tDecal.iOlder].iNewer = tDecal.iNewer;
+    else
+        m_iOldest = tDecal.iNewer;
+
+    if (tDecal.iNewer != NO_SLOT)
+        m_Decals[tDecal.iNewer].iOlder = tDecal.iOlder;
+    else
+        m_iNewest = tDecal.iOlder;
+
+    tDecal.iOlder = tDecal.iNewer = NO_SLOT;
+}
+
+_int CDecal_Persistent::Find_Overlap(_uint iMaterialID, const _float3& vMin, const _float3& vMax) const
+{
+    _float fVolume = (vMax.x - vMin.x) * (vMax.y - vMin.y) * (vMax.z - vMin.z);
+    if (fVolume <= 0.f)
+        return -1;
+
+    _float3 vCenter = _float3((vMin.x + vMax.x) * 0.5f, (vMin.y + vMax.y) * 0.5f, (vMin.z + vMax.z) * 0.5f);
+    _int iCX = _int(floorf(vCenter.x / m_tDesc.fCellSize));
+    _int iCY = _int(floorf(vCenter.y / m_tDesc.fCellSize));
+    _int iCZ = _int(floorf(vCenter.z / m_tDesc.fCellSize));
+
+    _int iBest = -1;
+    _float fBestRatio = m_tDesc.fMergeRatio;
+
+    // ߽  ̿ 26  ˻
+    for (_int z = -1; z <= 1; ++z)
+        for (_int y = -1; y <= 1; ++y)
+            for (_int x = -1; x <= 1; ++x)
+            {
+                auto iter = m_Cells.find(Make_CellKey(iCX + x, iCY + y, iCZ + z));
+                if (iter == m_Cells.end())
+                    continue;
+
+                for (_uint iSlot : iter->second)
+                {
+                    const DECAL& tDecal = m_Decals[iSlot];
+                    if (tDecal.iMaterialID != iMaterialID)
+                        continue;
+
+                    _float fDX = min(vMax.x, tDecal.vAABBMax.x) - max(vMin.x, tDecal.vAABBMin.x);
+                    _float fDY = min(vMax.y, tDecal.vAABBMax.y) - max(vMin.y, tDecal.vAABBMin.y);
+                    _float fDZ = min(vMax.z, tDecal.vAABBMax.z) - max(vMin.z, tDecal.vAABBMin.z);
+                    if (fDX <= 0.f || fDY <= 0.f || fDZ <= 0.f)
+                        continue;
+
+                    _float fRatio = (fDX * fDY * fDZ) / fVolume;
+                    if (fRatio >= fBestRatio)
+                    {
+                        fBestRatio = fRatio;
+                        iBest = (_int)iSlot;
+                    }
+                }
+            }
+
+    return iBest;
+}
+
+CDecal_Persistent* CDecal_Persistent::Create(const DESC& tDesc)
+{
+    CDecal_Persistent* pInstance = new CDecal_Persistent();
+
+    if (FAILED(pInstance->Initialize(tDesc)))
+    {
+        MSG_BOX("Failed To Created : CDecal_Persistent");
+        Safe_Release(pInstance);
+    }
+
+    return pInstance;
+}
+
+void CDecal_Persistent::Free()
+{
+    __super::Free();
+
+    m_Cells.clear();
+    m_Decals.clear();
+    m_FreeSlots.clear();
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "Client_Defines.h"
+#include "Base.h"
+
+BEGIN(Client)
+
+class CDecal_Batch;
+
+//  , ó   Į  
+//  Ʈ   뷮  迭 ͸ ϰ(  켱,  á     ü),
+//    ڸ  ġ   ʰ   ϰų 
+// ->  ƹ  ޸𸮿 ο  
+class CDecal_Persistent final : public CBase
+{
+public:
+	struct DESC
+	{
+		_uint		iCapacity = { 256 };
+		_float		fCellSize = { 1.f };		//  ؽ  ũ(Ϲ Į ũ ̻)
+		_float		fMergeRatio = { 0.7f };		//  Į   ħ   ̸̻ 
+		_float		fRejectAge = { 0.25f };		//   ̺    
+	};
+
+	// ADD_REJECTED:   ʹ ų, ġ  ؽ ( ǥ +-MAX_CELL_COORD) 
+	enum ADD_RESULT { ADD_INSERTED, ADD_MERGED, ADD_REJECTED, ADD_END };
+
+	struct DECAL
+	{
+		_float4x4	WorldMatrix;
+		_float3		vBoxSize;
+		_float4		vColor;
+		_float3		vAABBMin, vAABBMax;
+		_uint		iMaterialID;
+		_float		fAge;
+		_float		fLifeTime;
+		_bool		bAlive;
+		_uint		iOlder, iNewer;		// /  (NO_SLOT̸ )
+	};
+
+private:
+	CDecal_Persistent() = default;
+	virtual ~CDecal_Persistent() = default;
+
+public:
+	HRESULT					Initialize(const DESC& tDesc);
+
+public:
+	ADD_RESULT				Add(_uint iMaterialID, _fmatrix WorldMatrix, const _float3& vBoxSize, const _float4& vColor, _float fLifeTime);
+	// ü  ϰ ,   ؽÿ 
+	void					Update(_float fTimeDelta);
+	//   ִ fDuration ٿ ϰ ̵ƿ( ȯ, ƽ )
+	void					Fade_Out_All(_float fDuration);
+	void					Clear();
+
+	// ִ Į  ͺ ġ  ( Į  , ̴ ̵ fAge / fLifeTime)
+	void					Submit(CDecal_Batch* pBatch) const;
+
+	_uint					Get_NumAlive() const { return m_iNumAlive; }
+	_uint					Get_Capacity() const { return (_uint)m_Decals.size(); }
+	const DECAL&			Get_Decal(_uint iSlot) const { return m_Decals[iSlot]; }
+
+private:
+	_uint64					Make_CellKey(_int iX, _int iY, _int iZ) const;
+	_uint64					Make_CellKey(const _float3& vPos) const;
+	_bool					Is_CellInRange(const _float3& vPos) const;
+	void					Insert_Hash(_uint iSlot);
+	void					Remove_Hash(_uint iSlot);
+	void					Kill(_uint iSlot);
+	void					Link_Newest(_uint iSlot);
+	void					Unlink(_uint iSlot);
+	_int					Find_Overlap(_uint iMaterialID, const _float3& vMin, const _float3& vMax) const;
+
+private:
+	static constexpr _uint	NO_SLOT = 0xFFFFFFFF;
+	//  ǥ  21Ʈ ŷϹǷ ̿ (+-1) Ű ġ ʴ 
+	static constexpr _int	MAX_CELL_COORD = (1 << 20) - 2;
+
+	DESC					m_tDesc = {};
+	vector<DECAL>			m_Decals;
+	vector<_uint>			m_FreeSlots;		//   
+	_uint					m_iOldest = { NO_SLOT };	// ü (  /)
+	_uint					m_iNewest = { NO_SLOT };
+	_uint					m_iNumAlive = {};
+
+	unordered_map<_uint64, vector<_uint>>	m_Cells;	// (߽ ) -> 
+
+public:
+	static CDecal_Persistent* Create(const DESC& tDesc);
+	virtual void			Free() override;
+};
+
+END
@@ -0,0 +1,272 @@
+#include "Decal_Reconstruct.h"
+
+namespace
+{
+    //   * (HLSL mul(v, M)  Ծ)
+    _float4 Transform(const _float4& v, const _float4x4& M)
+    {
+        _float4 vOut;
+        vOut.x = v.x * M.m[0][0] + v.y * M.m[1][0] + v.z * M.m[2][0] + v.w * M.m[3][0];
+        vOut.y = v.x * M.m[0][1] + v.y * M.m[1][1] + v.z * M.m[2][1] + v.w * M.m[3][1];
+        vOut.z = v.x * M.m[0][2] + v.y * M.m[1][2] + v.z * M.m[2][2] + v.w * M.m[3][2];
+        vOut.w = v.x * M.m[0][3] + v.y * M.m[1][3] + v.z * M.m[2][3] + v.w * M.m[3][3];
+        return vOut;
+    }
+
+    //    ȯ(w = 1,  )
+    _float3 Transform_Point(const _float3& v, const _float4x4& M)
+    {
+        _float4 vOut = Transform(_float4(v.x, v.y, v.z, 1.f), M);
+        return _float3(vOut.x, vOut.y, vOut.z);
+    }
+
+    // μ  , Ư ̸ false
+    _bool Inverse(const _float4x4& M, _float4x4* pOut)
+    {
+        const _float* a = &M.m[0][0];
+        _float inv[16];
+
+        inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+        inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+        inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+        inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+        inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+        inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+        inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+        inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+        inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+        inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+        inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+        inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+        inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+        inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+        inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+        inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+        _float fDet = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+        if (fDet == 0.f)
+            return false;
+
+        _float fInvDet = 1.f / fDet;
+        _float* pDst = &pOut->m[0][0];
+        for (_uint i = 0; i < 16; ++i)
+            pDst[i] = inv[i] * fInvDet;
+
+        return true;
+    }
+
+    // VIBuffer_Cube ( 0.5) 12 ﰢ
+    const _float3 s_BoxCorners[8] = {
+        { -0.5f,  0.5f, -0.5f }, {  0.5f,  0.5f, -0.5f }, {  0.5f, -0.5f, -0.5f }, { -0.5f, -0.5f, -0.5f },
+        { -0.5f,  0.5f,  0.5f }, {  0.5f,  0.5f,  0.5f }, {  0.5f, -0.5f,  0.5f }, { -0.5f, -0.5f,  0.5f },
+    };
+
+    const _uint s_BoxIndices[36] = {
+        1, 5, 6,  1, 6, 2,      // +X
+        4, 0, 3,  4, 3, 7,      // -X
+        4, 5, 1,  4, 1, 0,      // +Y
+        3, 2, 6,  3, 6, 7,      // -Y
+        5, 4, 7,  5, 7, 6,      // +Z
+        0, 1, 2,  0, 2, 3,      // -Z
+    };
+
+    //  ܰ    ʿ ͸
+    struct VERTEX_OUT
+    {
+        _float4     vClipPos;
+        _float4     vLocalRay;
+    };
+
+    _float4 Lerp(const _float4& a, const _float4& b, _float t)
+    {
+        return _float4(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t);
+    }
+
+    // Ͷ  (Ŭ z >= 0) Ŭ, Ӽ Ŭ   
+    // ﰢ ϳ ִ 簢( 4) ,    ȯ
+    _uint Clip_NearPlane(const VERTEX_OUT* pIn[3], VERTEX_OUT* pOut)
+    {
+        _uint iNumOut = 0;
+        for (_uint i = 0; i < 3; ++i)
+        {
+            const VERTEX_OUT& A = *pIn[i];
+            const VERTEX_OUT& B = *pIn[(i + 1) % 3];
+            _bool bInA = A.vClipPos.z >= 0.f, bInB = B.vClipPos.z >= 0.f;
+
+            if (bInA)
+                pOut[iNumOut++] = A;
+
+            if (bInA != bInB)
+            {
+                _float t = A.vClipPos.z / (A.vClipPos.z - B.vClipPos.z);
+                pOut[iNumOut++] = { Lerp(A.vClipPos, B.vClipPos, t), Lerp(A.vLocalRay, B.vLocalRay, t) };
+            }
+        }
+        return iNumOut;
+    }
+}
+
+_float3 CDecal_Reconstruct::Local_FromMatrices(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrixInv, const _float2& vUV, const _float2& vDepth)
+{
+    return Transform_Point(World_FromDepth(tCamera, vUV, vDepth), WorldMatrixInv);
+}
+
+_float3 CDecal_Reconstruct::Local_FromViewRay(const CAMERA_DESC& tCamera, const _float3& vLocalCamPos, const _float4& vLocalRay, _float fDepthY)
+{
+    // PS_DECAL_SLASH_VIEWRAY: vLocalCamPos + vLocalRay.xyz * (fViewZ / vLocalRay.w)
+    _float fViewZ = fDepthY * tCamera.fFar;
+    _float fScale = fViewZ / vLocalRay.w;
+
+    return _float3(vLocalCamPos.x + vLocalRay.x * fScale,
+                   vLocalCamPos.y + vLocalRay.y * fScale,
+                   vLocalCamPos.z + vLocalRay.z * fScale);
+}
+
+void CDecal_Reconstruct::Make_ViewRay(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrixInv, const _float3& vVertexWorldPos, _float3* pLocalCamPos, _float4* pLocalRay)
+{
+    _float4x4 ViewInv;
+    Inverse(tCamera.ViewMatrix, &ViewInv);
+
+    _float3 vCamWorldPos = _float3(ViewInv.m[3][0], ViewInv.m[3][1], ViewInv.m[3][2]);
+
+    _float3 vLocalVertex = Transform_Point(vVertexWorldPos, WorldMatrixInv);
+    _float3 vLocalCam = Transform_Point(vCamWorldPos, WorldMatrixInv);
+    _float fViewZ = Transform_Point(vVertexWorldPos, tCamera.ViewMatrix).z;
+
+    *pLocalCamPos = vLocalCam;
+    *pLocalRay = _float4(vLocalVertex.x - vLocalCam.x, vLocalVertex.y - vLocalCam.y, vLocalVertex.z - vLocalCam.z, fViewZ);
+}
+
+CDecal_Reconstruct::COMPARE_RESULT CDecal_Reconstruct::Compare(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrix, _uint iGridSize, const vector<_float>& ViewZs)
+{
+    COMPARE_RESULT tResult = {};
+
+    _float4x4 WorldMatrixInv;
+    if (iGridSize < 2 || ViewZs.empty() || tCamera.fFar <= 0.f || !Inverse(WorldMatrix, &WorldMatrixInv))
+        return tResult;
+
+    //  ܰ: 8 𼭸   ( ī޶ ġ nointerpolation̶ ϳ)
+    _float3 vLocalCamPos = {};
+    VERTEX_OUT Vertices[8];
+    for (_uint i = 0; i < 8; ++i)
+    {
+        _float3 vWorld = Transform_Point(s_BoxCorners[i], WorldMatrix);
+        _float4 vView = Transform(_float4(vWorld.x, vWorld.y, vWorld.z, 1.f), tCamera.ViewMatrix);
+
+        Vertices[i].vClipPos = Transform(vView, tCamera.ProjMatrix);
+        Make_ViewRay(tCamera, WorldMatrixInv, vWorld, &vLocalCamPos, &Vertices[i].vLocalRay);
+    }
+
+    double dSumError = 0.0;
+
+    auto Rasterize = [&](const VERTEX_OUT* pV[3])
+    {
+        // ȭ (NDC) 
+        _float2 vNdc[3];
+        for (_uint i = 0; i < 3; ++i)
+            vNdc[i] = _float2(pV[i]->vClipPos.x / pV[i]->vClipPos.w, pV[i]->vClipPos.y / pV[i]->vClipPos.w);
+
+        _float fArea = (vNdc[1].x - vNdc[0].x) * (vNdc[2].y - vNdc[0].y) - (vNdc[2].x - vNdc[0].x) * (vNdc[1].y - vNdc[0].y);
+        if (fabsf(fArea) < 1e-8f)
+            return;
+
+        for (_uint y = 0; y < iGridSize; ++y)
+        {
+            for (_uint x = 0; x < iGridSize; ++x)
+            {
+                _float2 vUV = _float2(_float(x) / _float(iGridSize - 1), _float(y) / _float(iGridSize - 1));
+                _float2 vPixel = _float2(vUV.x * 2.f - 1.f, vUV.y * -2.f + 1.f);
+
+                // ȭ  ߽ ǥ(Ͷ Ŀ)
+                _float fB[3];
+                fB[0] = ((vNdc[1].x - vPixel.x) * (vNdc[2].y - vPixel.y) - (vNdc[2].x - vPixel.x) * (vNdc[1].y - vPixel.y)) / fArea;
+                fB[1] = ((vNdc[2].x - vPixel.x) * (vNdc[0].y - vPixel.y) - (vNdc[0].x - vPixel.x) * (vNdc[2].y - vPixel.y)) / fArea;
+                fB[2] = 1.f - fB[0] - fB[1];
+
+                if (fB[0] < 0.f || fB[1] < 0.f || fB[2] < 0.f)
+                    continue;
+
+                //   : Ӽ/w  ϰ 1/w  
+                _float fSumInvW = 0.f;
+                _float4 vLocalRay = {};
+                for (_uint i = 0; i < 3; ++i)
+                {
+                    _float fWeight = fB[i] / pV[i]->vClipPos.w;
+                    fSumInvW += fWeight;
+                    vLocalRay.x += pV[i]->vLocalRay.x * fWeight;
+                    vLocalRay.y += pV[i]->vLocalRay.y * fWeight;
+                    vLocalRay.z += pV[i]->vLocalRay.z * fWeight;
+                    vLocalRay.w += pV[i]->vLocalRay.w * fWeight;
+                }
+                vLocalRay = _float4(vLocalRay.x / fSumInvW, vLocalRay.y / fSumInvW, vLocalRay.z / fSumInvW, vLocalRay.w / fSumInvW);
+
+                for (_float fViewZ : ViewZs)
+                {
+                    //  Ÿ texel(x:  z/w, y:  z / far)
+                    _float2 vDepth = _float2(Depth_FromViewZ(tCamera, fViewZ), fViewZ / tCamera.fFar);
+
+                    _float3 vRef = Local_FromMatrices(tCamera, WorldMatrixInv, vUV, vDepth);
+                    _float3 vRay = Local_FromViewRay(tCamera, vLocalCamPos, vLocalRay, vDepth.y);
+
+                    _float fDX = vRef.x - vRay.x, fDY = vRef.y - vRay.y, fDZ = vRef.z - vRay.z;
+                    _float fError = sqrtf(fDX * fDX + fDY * fDY + fDZ * fDZ);
+
+                    tResult.fMaxError = max(tResult.fMaxError, fError);
+                    dSumError += fError;
+                    ++tResult.iNumSamples;
+                }
+            }
+        }
+    };
+
+    for (_uint iTriangle = 0; iTriangle < 12; ++iTriangle)
+    {
+        const VERTEX_OUT* pV[3] = {
+            &Vertices[s_BoxIndices[iTriangle * 3 + 0]],
+            &Vertices[s_BoxIndices[iTriangle * 3 + 1]],
+            &Vertices[s_BoxIndices[iTriangle * 3 + 2]] };
+
+        // 鿡 ģ ﰢ ߶ ä÷ ٽ ﰢȭ
+        VERTEX_OUT Clipped[4];
+        _uint iNumClipped = Clip_NearPlane(pV, Clipped);
+        if (iNumClipped < 3)
+            continue;
+
+        ++tResult.iNumTriangles;
+        if (pV[0]->vClipPos.z < 0.f || pV[1]->vClipPos.z < 0.f || pV[2]->vClipPos.z < 0.f)
+            ++tResult.iNumClipped;
+
+        for (_uint i = 1; i + 1 < iNumClipped; ++i)
+        {
+            const VERTEX_OUT* pFan[3] = { &Clipped[0], &Clipped[i], &Clipped[i + 1] };
+            Rasterize(pFan);
+        }
+    }
+
+    if (tResult.iNumSamples > 0)
+        tResult.fAvgError = _float(dSumError / tResult.iNumSamples);
+
+    return tResult;
+}
+
+_float CDecal_Reconstruct::Depth_FromViewZ(const CAMERA_DESC& tCamera, _float fViewZ)
+{
+    const _float4x4& Proj = tCamera.ProjMatrix;
+
+    return (fViewZ * Proj._33 + Proj._43) / (fViewZ * Proj._34 + Proj._44);
+}
+
+_float3 CDecal_Reconstruct::World_FromDepth(const CAMERA_DESC& tCamera, const _float2& vUV, const _float2& vDepth)
+{
+    _float4x4 ProjInv, ViewInv;
+    Inverse(tCamera.ProjMatrix, &ProjInv);
+    Inverse(tCamera.ViewMatrix, &ViewInv);
+
+    // ReconstructWorldPos: Ŭ ǥ  z(=  Ÿ y * far)    ǵ
+    _float fViewZ = vDepth.y * tCamera.fFar;
+    _float4 vClip = _float4((vUV.x * 2.f - 1.f) * fViewZ, (vUV.y * -2.f + 1.f) * fViewZ, vDepth.x * fViewZ, fViewZ);
+
+    _float4 vWorld = Transform(Transform(vClip, ProjInv), ViewInv);
+
+    return _float3(vWorld.x, vWorld.y, vWorld.z);
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "Client_Defines.h"
+
+BEGIN(Client)
+
+// Shader_Effect_Decal.hlsl   Į  ǥ  θ CPU ״   
+// ̴     ġ ġ θ GPU  Ȯϱ 
+// DirectXMath  Į 길 ( ׽Ʈ ״ )
+class CDecal_Reconstruct final
+{
+public:
+	struct CAMERA_DESC
+	{
+		_float4x4	ViewMatrix;
+		_float4x4	ProjMatrix;
+		_float		fFar;		// g_vCamRange.y,  Ÿ y( z / far)  
+	};
+
+	struct COMPARE_RESULT
+	{
+		_float		fMaxError = {};
+		_float		fAvgError = {};
+		_uint		iNumSamples = {};
+		_uint		iNumTriangles = {};		//  Ŭ   ﰢ( )
+		_uint		iNumClipped = {};		//  鿡 ߸ ﰢ
+	};
+
+public:
+	// ReconstructWorldPos + g_WorldMatrixInv (PS_DECAL_SLASH)
+	// vDepth:  Ÿ texel(x:  z/w, y:  z / far)
+	static _float3			Local_FromMatrices(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrixInv, const _float2& vUV, const _float2& vDepth);
+
+	//   (PS_DECAL_SLASH_VIEWRAY)
+	// vLocalRay     (xyz:  ī޶->, w:    z)
+	static _float3			Local_FromViewRay(const CAMERA_DESC& tCamera, const _float3& vLocalCamPos, const _float4& vLocalRay, _float fDepthY);
+
+	//  ܰ (VS_MAIN_VIEWRAY): ڽ  ϳ   ī޶ ġ 
+	static void				Make_ViewRay(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrixInv, const _float3& vVertexWorldPos, _float3* pLocalCamPos, _float4* pLocalRay);
+
+	// ڽ ﰢ    ȭ (iGridSize x iGridSize) ȼ    
+	//  ȼ     (ViewZs)    ǥ  
+	//   ﰢ Ͷó Ŭ  ߶ ˻
+	static COMPARE_RESULT	Compare(const CAMERA_DESC& tCamera, const _float4x4& WorldMatrix, _uint iGridSize, const vector<_float>& ViewZs);
+
+	//  ķ  z شϴ  Ÿ x  
+	static _float			Depth_FromViewZ(const CAMERA_DESC& tCamera, _float fViewZ);
+
+private:
+	// ReconstructWorldPos ״
+	static _float3			World_FromDepth(const CAMERA_DESC& tCamera, const _float2& vUV, const _float2& vDepth);
+
+private:
+	CDecal_Reconstruct() = delete;
+};
+
+END
@@ -3,9 +3,9 @@
 
 // Engine_Shader_Defines.hlsli  Լ
 //  ȼ  ǥ ȯ
-float3 ReconstructWorldPos(float2 vUV)
+// ̹    ( ؽó ٽ  )
+float3 ReconstructWorldPos_FromDepth(float2 vUV, float4 vDepth)
 {
-    float4 vDepth = g_DepthTexture.Sample(Point_Clamp_Sampler, vUV);
     float fDepth = vDepth.x;
     float fViewZ = vDepth.y * g_vCamRange.y;
 
@@ -22,6 +22,11 @@ float3 ReconstructWorldPos(float2 vUV)
     return vWorldP;
 }
 
+float3 ReconstructWorldPos(float2 vUV)
+{
+    return ReconstructWorldPos_FromDepth(vUV, g_DepthTexture.Sample(Point_Clamp_Sampler, vUV));
+}
+
 //  
 matrix g_WorldMatrix, g_ViewMatrix, g_ProjMatrix;
 matrix g_WorldMatrixInv, g_ViewMatrixInv, g_ProjMatrixInv;
@@ -67,6 +72,61 @@ float g_fDistortSpeed;
 float4 g_vCamPosition;
 float2 g_vCamRange;
 
+//  ÷
+// ۹̼ (CDecal_Permutation) DECAL_PERMUTATION Բ  define   Ÿ  ǰ,
+//  ( ε )  ̴  ״: ũ/  ׻ , Ʋ/UV ִϸ̼   
+// ( ̴ g_bUseAtlas_*/g_bUseUVAnimation Ƿ ⼭   Ʈ  ٲ, ۹̼θ )
+#ifdef DECAL_PERMUTATION
+    #ifndef DECAL_USE_MASK
+        #define DECAL_USE_MASK 0
+    #endif
+    #ifndef DECAL_USE_COLOR
+        #define DECAL_USE_COLOR 0
+    #endif
+    #ifndef DECAL_USE_ATLAS_DIFFUSE
+        #define DECAL_USE_ATLAS_DIFFUSE 0
+    #endif
+    #ifndef DECAL_USE_ATLAS_MASK
+        #define DECAL_USE_ATLAS_MASK 0
+    #endif
+    #ifndef DECAL_USE_UV_ANIMATION
+        #define DECAL_USE_UV_ANIMATION 0
+    #endif
+    #define USE_MASK            DECAL_USE_MASK
+    #define USE_COLOR           DECAL_USE_COLOR
+    #define USE_ATLAS_DIFFUSE   DECAL_USE_ATLAS_DIFFUSE
+    #define USE_ATLAS_MASK      DECAL_USE_ATLAS_MASK
+    #define USE_UV_ANIMATION    DECAL_USE_UV_ANIMATION
+#else
+    #define USE_MASK            true
+    #define USE_COLOR           true
+    #define USE_ATLAS_DIFFUSE   false
+    #define USE_ATLAS_MASK      false
+    #define USE_UV_ANIMATION    false
+#endif
+
+// νϽ :   Į   ׸  νϽ 
+// CPU  CDecal_InstancePacker::DECAL_INSTANCE ̾ƿ ġ
+struct DECAL_INSTANCE
+{
+    row_major matrix WorldMatrix; // CPU XMFLOAT4X4 ״ ϹǷ row_major
+    row_major matrix WorldMatrixInv;
+    float4 vBoxSize;
+    float4 vColor;
+    float fElapsedTime;
+    float fLifeTime;
+    float2 vPadding;
+};
+
+StructuredBuffer<DECAL_INSTANCE> g_DecalInstances;
+uint g_iInstanceOffset; // ġ  νϽ
+
+// Ŭ : ȭ Ÿ x  ̽ Į (CDecal_ClusterBinner )
+Buffer<uint2> g_ClusterRanges; // ( , )
+Buffer<uint> g_ClusterDecalIndices; // g_DecalInstances ε
+uint4 g_vClusterDims; // (Ÿ X , Ÿ Y , ̽ , Ÿ ȼ ũ)
+float2 g_vClusterZParams; // slice = log(viewZ) * x + y
+
 struct VS_IN
 {
     float3 vPosition : POSITION; // [-0.5, 0.5]  ť ->  ȯ
@@ -97,6 +157,63 @@ VS_OUT VS_MAIN(VS_IN In)
     return Out;
 }
 
+struct VS_OUT_VIEWRAY
+{
+    float4 vPosition : SV_POSITION;
+    float4 vClipPos : TEXCOORD0;
+    float4 vLocalRay : TEXCOORD1; // xyz: Į   ī޶-> , w:   z
+    nointerpolation float3 vLocalCamPos : TEXCOORD2; // Į   ī޶ ġ
+};
+
+//   Vertex Shader
+//  Į     ѱ PS   z -    ġ 
+//   z  3D ̶     Ȯϰ,  Ŭο 
+VS_OUT_VIEWRAY VS_MAIN_VIEWRAY(VS_IN In)
+{
+    VS_OUT_VIEWRAY Out = (VS_OUT_VIEWRAY) 0;
+
+    float4 vWorldPos = mul(float4(In.vPosition, 1.f), g_WorldMatrix);
+    float4 vViewPos = mul(vWorldPos, g_ViewMatrix);
+    float4 vClipPos = mul(vViewPos, g_ProjMatrix);
+
+    float3 vLocalVertex = mul(vWorldPos, g_WorldMatrixInv).xyz;
+    float3 vLocalCam = mul(float4(g_vCamPosition.xyz, 1.f), g_WorldMatrixInv).xyz;
+
+    Out.vPosition = vClipPos;
+    Out.vClipPos = vClipPos;
+    Out.vLocalRay = float4(vLocalVertex - vLocalCam, vViewPos.z);
+    Out.vLocalCamPos = vLocalCam;
+
+    return Out;
+}
+
+struct VS_OUT_INSTANCED
+{
+    float4 vPosition : SV_POSITION;
+    float3 vLocalPos : TEXCOORD0;
+    float4 vClipPos : TEXCOORD1;
+    nointerpolation uint iInstanceID : TEXCOORD2; // PS νϽ  ȸ
+};
+
+// νϽ Vertex Shader
+//      νϽ ۿ 
+VS_OUT_INSTANCED VS_MAIN_INSTANCED(VS_IN In, uint iInstanceID : SV_InstanceID)
+{
+    VS_OUT_INSTANCED Out = (VS_OUT_INSTANCED) 0;
+
+    uint iInstance = g_iInstanceOffset + iInstanceID;
+
+    float4 vWorldPos = mul(float4(In.vPosition, 1.f), g_DecalInstances[iInstance].WorldMatrix);
+    float4 vClipPos = mul(vWorldPos, mul(g_ViewMatrix, g_ProjMatrix));
+
+    Out.vPosition = vClipPos;
+    Out.vClipPos = vClipPos;
+    Out.vLocalPos = In.vTexcoord;
+    Out.iInstanceID = iInstance;
+
+    return Out;
+}
+
 struct PS_IN
 {
     float4 vPosition : SV_POSITION;
@@ -104,44 +221,50 @@ struct PS_IN
     float4 vClipPos : TEXCOORD1;
 };
 
+struct PS_IN_INSTANCED
+{
+    float4 vPosition : SV_POSITION;
+    float3 vLocalPos : TEXCOORD0;
+    float4 vClipPos : TEXCOORD1;
+    nointerpolation uint iInstanceID : TEXCOORD2;
+};
+
 struct PS_OUT
 {
     float4 vColor : SV_TARGET0;
 };
 
-// Pixel Shader
-// Į ̴  ڻ Į ̴
-PS_OUT PS_DECAL_SLASH(PS_IN In)
+// Ʋ UV
+// UV ִϸ̸̼  ð  ε , ƴϸ  ε
+float2 Get_AtlasUV(float2 vUV, float fElapsedTime)
 {
-    PS_OUT Out;
-    
-    // ȭ UV 
-    float2 vScreenUV = In.vClipPos.xy / In.vClipPos.w * float2(0.5f, -0.5f) + 0.5f;
-    // ̷κ  ġ 籸
-    float3 vWorldPos = ReconstructWorldPos(vScreenUV);
-    // Į ڽ  ǥ
-    float4 vLocalPos = mul(float4(vWorldPos, 1.f), g_WorldMatrixInv);
-    // ڽ  ũ
-    float3 vHalfSize = g_vBoxSize * 0.5f;
+    int iNumFrames = max(g_iNumUVCols * g_iNumUVRows, 1);
+    int iIndex = USE_UV_ANIMATION ? (int) (fElapsedTime * g_fUVFrameSpeed) % iNumFrames : g_iUVIndex;
 
-    // ڽ  ̸ 
-    if (any(abs(vLocalPos.xyz) > vHalfSize))
-        discard;
+    float2 vCell = float2(iIndex % max(g_iNumUVCols, 1), iIndex / max(g_iNumUVCols, 1));
 
-    //  ȼ 븻 ͼ ġ 
-    float3 vNormal = normalize(g_NormalTexture.Sample(Point_Clamp_Sampler, vScreenUV).rgb * 2.0f - 1.0f);
+    return (vUV + vCell) / float2(max(g_iNumUVCols, 1), max(g_iNumUVRows, 1));
+}
+
+// ڻ Į  ø
+// ڽ  ǥ  븻 ̹ غ ¿  (ڽ /Ŭ  )
+float4 Sample_DecalSlash(float3 vLocalPos, float3 vNormal, float3 vBoxSize, float4 vDecalColor, float fElapsedTime, float fLifeTime)
+{
+    float3 vHalfSize = vBoxSize * 0.5f;
+
+    // 븻 ġ 
     float3 vAbs = abs(vNormal);
     float fInvSum = 1.f / (vAbs.x + vAbs.y + vAbs.z + 1e-6f);
     float3 vWeight = vAbs * fInvSum;
     
     //  ະ UV ( )
     float2 UVAxis[3];
-    UVAxis[0] = float2((vLocalPos.z + vHalfSize.z) / g_vBoxSize.z,
-                        1.f - ((vLocalPos.y + vHalfSize.y) / g_vBoxSize.y));
-    UVAxis[1] = float2((vLocalPos.x + vHalfSize.x) / g_vBoxSize.x,
-                        1.f - ((vLocalPos.z + vHalfSize.z) / g_vBoxSize.z));
-    UVAxis[2] = float2((vLocalPos.x + vHalfSize.x) / g_vBoxSize.x,
-                        1.f - ((vLocalPos.y + vHalfSize.y) / g_vBoxSize.y));
+    UVAxis[0] = float2((vLocalPos.z + vHalfSize.z) / vBoxSize.z,
+                        1.f - ((vLocalPos.y + vHalfSize.y) / vBoxSize.y));
+    UVAxis[1] = float2((vLocalPos.x + vHalfSize.x) / vBoxSize.x,
+                        1.f - ((vLocalPos.z + vHalfSize.z) / vBoxSize.z));
+    UVAxis[2] = float2((vLocalPos.x + vHalfSize.x) / vBoxSize.x,
+                        1.f - ((vLocalPos.y + vHalfSize.y) / vBoxSize.y));
 
     //  ġ ū  ε 
     int iAxis = 0;
@@ -153,38 +276,178 @@ PS_OUT PS_DECAL_SLASH(PS_IN In)
     //  UV
     float2 vFinalUV = UVAxis[iAxis];
     
-    // ø
-    float4 vColorX = g_DiffuseTexture.Sample(Linear_Clamp_Sampler, UVAxis[iAxis]);
-    float4 vColorY = g_DiffuseTexture.Sample(Linear_Clamp_Sampler, UVAxis[iAxis]);
-    float4 vColorZ = g_DiffuseTexture.Sample(Linear_Clamp_Sampler, UVAxis[iAxis]);
-
-    float4 vColor;
+    // ø(    UVǷ  )
+    float4 vColor = g_DiffuseTexture.Sample(Linear_Clamp_Sampler, USE_ATLAS_DIFFUSE ? Get_AtlasUV(vFinalUV, fElapsedTime) : vFinalUV);
     
-    // ִ ġ ุ 
-    if (vWeight.x > vWeight.y && vWeight.x > vWeight.z)
-        vColor = vColorX;
-    else if (vWeight.y > vWeight.x && vWeight.y > vWeight.z)
-        vColor = vColorY;
-    else
-        vColor = vColorZ;
+    if (USE_MASK)
+    {
+        float fMask = g_MaskTexture.Sample(LinearSampler, USE_ATLAS_MASK ? Get_AtlasUV(vFinalUV, fElapsedTime) : vFinalUV).r;
+        vColor *= fMask;
+    }
     
-    float fMask = g_MaskTexture.Sample(LinearSampler, UVAxis[iAxis]).r;
+    // Į (νϽ/ Į νϽ ,  ο Get_MaterialColor)
+    vColor.rgb *= vDecalColor.rgb;
+    vColor.a *= vDecalColor.a;
 
-    vColor *= fMask;
-    
-    vColor.rgb *= g_vColor.rgb * g_fBright;
-    vColor.a *= g_vColor.a;
+    vColor.rgb *= g_fBright;
     
-    float fLifeRatio = saturate(g_fElapsedTime / g_fLifeTime);
+    float fLifeRatio = saturate(fElapsedTime / fLifeTime);
 
     float fFadeAlpha = saturate(1.f - fLifeRatio);
     vColor.a *= fFadeAlpha;
     
-    Out.vColor = vColor;
+    return vColor;
+}
+
+//  ο  
+// DECAL_USE_COLOR  ۹̼Ǹ ,  ܿ g_vColor
+float4 Get_MaterialColor()
+{
+    return USE_COLOR ? g_vColor : float4(1.f, 1.f, 1.f, 1.f);
+}
+
+// ڻ Į  ̵
+//  ο νϽ ΰ Į  ٸ Ѱܼ  
+float4 Shade_DecalSlash(float4 vClipPos, matrix WorldMatrixInv, float3 vBoxSize, float4 vDecalColor, float fElapsedTime, float fLifeTime)
+{
+    // ȭ UV 
+    float2 vScreenUV = vClipPos.xy / vClipPos.w * float2(0.5f, -0.5f) + 0.5f;
+    // ̷κ  ġ 籸
+    float3 vWorldPos = ReconstructWorldPos(vScreenUV);
+    // Į ڽ  ǥ
+    float4 vLocalPos = mul(float4(vWorldPos, 1.f), WorldMatrixInv);
+    // ڽ  ũ
+    float3 vHalfSize = vBoxSize * 0.5f;
+
+    // ڽ  ̸ 
+    if (any(abs(vLocalPos.xyz) > vHalfSize))
+        discard;
+
+    //  ȼ 븻
+    float3 vNormal = normalize(g_NormalTexture.Sample(Point_Clamp_Sampler, vScreenUV).rgb * 2.0f - 1.0f);
+
+    return Sample_DecalSlash(vLocalPos.xyz, vNormal, vBoxSize, vDecalColor, fElapsedTime, fLifeTime);
+}
+
+// Pixel Shader
+// Į ̴  ڻ Į ̴
+PS_OUT PS_DECAL_SLASH(PS_IN In)
+{
+    PS_OUT Out;
+    
+    Out.vColor = Shade_DecalSlash(In.vClipPos, g_WorldMatrixInv, g_vBoxSize.xyz, Get_MaterialColor(), g_fElapsedTime, g_fLifeTime);
     
     return Out;
 }
 
+struct PS_IN_VIEWRAY
+{
+    float4 vPosition : SV_POSITION;
+    float4 vClipPos : TEXCOORD0;
+    float4 vLocalRay : TEXCOORD1;
+    nointerpolation float3 vLocalCamPos : TEXCOORD2;
+};
+
+// ڻ Į   
+// ReconstructWorldPos /          + -  
+PS_OUT PS_DECAL_SLASH_VIEWRAY(PS_IN_VIEWRAY In)
+{
+    PS_OUT Out;
+
+    float2 vScreenUV = In.vClipPos.xy / In.vClipPos.w * float2(0.5f, -0.5f) + 0.5f;
+    float fViewZ = g_DepthTexture.Sample(Point_Clamp_Sampler, vScreenUV).y * g_vCamRange.y;
+
+    float3 vLocalPos = In.vLocalCamPos + In.vLocalRay.xyz * (fViewZ / In.vLocalRay.w);
+
+    if (any(abs(vLocalPos) > g_vBoxSize.xyz * 0.5f))
+        discard;
+
+    float3 vNormal = normalize(g_NormalTexture.Sample(Point_Clamp_Sampler, vScreenUV).rgb * 2.0f - 1.0f);
+
+    Out.vColor = Sample_DecalSlash(vLocalPos, vNormal, g_vBoxSize.xyz, Get_MaterialColor(), g_fElapsedTime, g_fLifeTime);
+
+    return Out;
+}
+
+// ڻ Į νϽ 
+PS_OUT PS_DECAL_SLASH_INSTANCED(PS_IN_INSTANCED In)
+{
+    PS_OUT Out;
+
+    DECAL_INSTANCE tDecal = g_DecalInstances[In.iInstanceID];
+
+    Out.vColor = Shade_DecalSlash(In.vClipPos, tDecal.WorldMatrixInv, tDecal.vBoxSize.xyz, tDecal.vColor, tDecal.fElapsedTime, tDecal.fLifeTime);
+
+    return Out;
+}
+
+struct VS_OUT_FULLSCREEN
+{
+    float4 vPosition : SV_POSITION;
+    float2 vTexcoord : TEXCOORD0;
+};
+
+//    SV_VertexID ȭ ü  ﰢ ϳ 
+VS_OUT_FULLSCREEN VS_FULLSCREEN(uint iVertexID : SV_VertexID)
+{
+    VS_OUT_FULLSCREEN Out = (VS_OUT_FULLSCREEN) 0;
+
+    Out.vTexcoord = float2((iVertexID << 1) & 2, iVertexID & 2);
+    Out.vPosition = float4(Out.vTexcoord * float2(2.f, -2.f) + float2(-1.f, 1.f), 0.f, 1.f);
+
+    return Out;
+}
+
+// Ŭ Į Pixel Shader
+// /븻 ȼ   а, ش Ŭ Į  ȸϸ 
+PS_OUT PS_DECAL_CLUSTERED(VS_OUT_FULLSCREEN In)
+{
+    PS_OUT Out;
+
+    float4 vDepth = g_DepthTexture.Sample(Point_Clamp_Sampler, In.vTexcoord);
+    float fViewZ = vDepth.y * g_vCamRange.y;
+
+    // ̰  ȼ(ϴ ) Į  ƴ
+    if (fViewZ <= 0.f)
+        discard;
+
+    // ̴ ȼ   
+    float3 vWorldPos = ReconstructWorldPos_FromDepth(In.vTexcoord, vDepth);
+    float3 vNormal = normalize(g_NormalTexture.Sample(Point_Clamp_Sampler, In.vTexcoord).rgb * 2.0f - 1.0f);
+
+    uint2 vTile = min(uint2(In.vPosition.xy) / g_vClusterDims.w, g_vClusterDims.xy - 1);
+    uint iSlice = (uint) clamp(log(fViewZ) * g_vClusterZParams.x + g_vClusterZParams.y, 0.f, (float) (g_vClusterDims.z - 1));
+    uint iCluster = (iSlice * g_vClusterDims.y + vTile.y) * g_vClusterDims.x + vTile.x;
+
+    uint2 vRange = g_ClusterRanges[iCluster];
+
+    //   over ռ(Ƽö )
+    float3 vAccumColor = 0.f;
+    float fAccumAlpha = 0.f;
+
+    for (uint i = 0; i < vRange.y; ++i)
+    {
+        DECAL_INSTANCE tDecal = g_DecalInstances[g_ClusterDecalIndices[vRange.x + i]];
+
+        float3 vLocalPos = mul(float4(vWorldPos, 1.f), tDecal.WorldMatrixInv).xyz;
+        if (any(abs(vLocalPos) > tDecal.vBoxSize.xyz * 0.5f))
+            continue;
+
+        float4 vColor = Sample_DecalSlash(vLocalPos, vNormal, tDecal.vBoxSize.xyz, tDecal.vColor, tDecal.fElapsedTime, tDecal.fLifeTime);
+
+        vAccumColor = vColor.rgb * vColor.a + vAccumColor * (1.f - vColor.a);
+        fAccumAlpha = vColor.a + fAccumAlpha * (1.f - vColor.a);
+    }
+
+    if (fAccumAlpha <= 0.f)
+        discard;
+
+    // BS_Blend(SrcAlpha, InvSrcAlpha) ° Ƽö
+    Out.vColor = float4(vAccumColor / fAccumAlpha, fAccumAlpha);
+
+    return Out;
+}
+
 // ...
 
 technique11 DefaultTechnique
@@ -200,5 +463,38 @@ technique11 DefaultTechnique
         PixelShader = compile ps_5_0 PS_DECAL_SLASH();
     }
 
+    pass DecalSlash_Instanced
+    {
+        SetRasterizerState(RS_Cull_None);
+        SetDepthStencilState(DSS_NonWriteZ, 0);
+        SetBlendState(BS_Blend, float4(0.f, 0.f, 0.f, 0.f), 0xffffffff);
+
+        VertexShader = compile vs_5_0 VS_MAIN_INSTANCED();
+        GeometryShader = NULL;
+        PixelShader = compile ps_5_0 PS_DECAL_SLASH_INSTANCED();
+    }
+
+    pass DecalSlash_ViewRay
+    {
+        SetRasterizerState(RS_Cull_None);
+        SetDepthStencilState(DSS_NonWriteZ, 0);
+        SetBlendState(BS_Blend, float4(0.f, 0.f, 0.f, 0.f), 0xffffffff);
+
+        VertexShader = compile vs_5_0 VS_MAIN_VIEWRAY();
+        GeometryShader = NULL;
+        PixelShader = compile ps_5_0 PS_DECAL_SLASH_VIEWRAY();
+    }
+
+    pass DecalClustered
+    {
+        SetRasterizerState(RS_Cull_None);
+        SetDepthStencilState(DSS_NonWriteZ, 0);
+        SetBlendState(BS_Blend, float4(0.f, 0.f, 0.f, 0.f), 0xffffffff);
+
+        VertexShader = compile vs_5_0 VS_FULLSCREEN();
+        GeometryShader = NULL;
+        PixelShader = compile ps_5_0 PS_DECAL_CLUSTERED();
+    }
+
     // ...
 }
\ No newline at end of file
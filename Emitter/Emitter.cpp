@@ -4,6 +4,8 @@
 #include "SocketParticle_Sprite.h"
 #include "SocketEffect_Mesh.h"
 #include "Effect_Decal.h"
+#include "Emitter_Snapshot.h"
+#include "Emitter_Timer.h"
 #include "Body.h"
 #include "Managers.h"
 
@@ -31,6 +33,9 @@ HRESULT CEmitter::Initialize(void* pArg)
 
     m_EffectGroups.clear();
 
+    // ̹͸ ٸ ⺻ Ʈ,  ʿϸ Set_RandomSeed 
+    Set_RandomSeed(_uint(reinterpret_cast<uintptr_t>(this) >> 4));
+
 	return S_OK;
 }
 
@@ -40,18 +45,35 @@ void CEmitter::Priority_Update(const _float& fTimeDelta, CGameObject* pOwner)
 
 void CEmitter::Update(const _float& fTimeDelta, CGameObject* pOwner)
 {
+    m_iSkippedThisFrame = 0;
+
+    _bool bSignificant = Is_Significant();
+    if (bSignificant && m_bVirtual)
+        Resume_FromVirtual();
+    m_bVirtual = !bSignificant;
+
     // Interval  Ǯ  Ȱȭ
     for (auto& [tag, group] : m_EffectGroups)
     {  
         if (!group.bGroupEnabled)
             continue;
 
-        for (auto& slot : group.persistent)
+        for (auto& slot : group)
         {
             if (slot.bOneShot)
                 continue;
         
+            //  : ߻ Ƚ  ( ߻   ð) 
+            if (m_bVirtual)
+            {
+                _uint iNumFired = CEmitter_Timer::Advance_Virtual(slot.fElapsed, slot.fInterval, slot.fLifeTime, fTimeDelta);
+                m_iSkippedThisFrame += iNumFired;
+                m_iSkippedTotal += iNumFired;
+                continue;
+            }
+
             slot.fElapsed += fTimeDelta;
+
             if (slot.fElapsed >= slot.fInterval)
             {
                 slot.fElapsed -= slot.fInterval;
@@ -61,8 +83,8 @@ void CEmitter::Update(const _float& fTimeDelta, CGameObject* pOwner)
                 {
                     pObj->Set_Active(true);
 
-                    Apply_Effect_Transform(pObj, nullptr, nullptr);
-                    Play_Effect(pObj);
+                    Apply_Effect_Transform(pObj, slot.bDecal, nullptr, nullptr);
+                    Play_Effect(pObj, slot.bDecal);
                 }
             }
         }
@@ -71,7 +93,7 @@ void CEmitter::Update(const _float& fTimeDelta, CGameObject* pOwner)
     //  Ʈ NULL
     for (auto& [_, group] : m_EffectGroups)
     {
-        for (auto& slot = group.persistent)
+        for (auto& slot : group)
         {
             if (slot.pEffect && slot.pEffect->Is_Dead())
                 slot.pEffect = nullptr;
@@ -83,6 +105,78 @@ void CEmitter::Late_Update(const _float& fTimeDelta, CGameObject* pOwner)
 {
 }
 
+void CEmitter::Enable_Significance(const SIGNIFICANCE_DESC& tDesc, SIGNIFICANCE_FUNC Test)
+{
+    m_bUseSignificance = true;
+    m_tSignificance = tDesc;
+    m_SignificanceTest = move(Test);
+}
+
+void CEmitter::Disable_Significance()
+{
+    m_bUseSignificance = false;
+    m_SignificanceTest = nullptr;
+}
+
+_bool CEmitter::Is_Significant()
+{
+    if (!m_bUseSignificance)
+        return true;
+
+    CGameObject* pOwner = Get_Owner();
+    if (m_SignificanceTest)
+        return m_SignificanceTest(pOwner);
+
+    auto* pTransform = pOwner ? pOwner->Get_Transform() : nullptr;
+    if (!pTransform)
+        return true;
+
+    _vector vPosition = pTransform->Get_State(CTransform::STATE_POSITION);
+
+    if (m_tSignificance.fMaxDistance > 0.f)
+    {
+        _vector vCamPosition = XMLoadFloat4(CGameInstance::GetInstance()->Get_CamPosition());
+        _float fDistSq = XMVectorGetX(XMVector3LengthSq(vPosition - vCamPosition));
+
+        if (fDistSq > m_tSignificance.fMaxDistance * m_tSignificance.fMaxDistance)
+            return false;
+    }
+
+    if (m_tSignificance.bUseFrustum && !CGameInstance::GetInstance()->isIn_Frustum_WorldSpace(vPosition, m_tSignificance.fBoundsRadius))
+        return false;
+
+    return true;
+}
+
+void CEmitter::Resume_FromVirtual()
+{
+    for (auto& [tag, group] : m_EffectGroups)
+    {
+        if (!group.bGroupEnabled)
+            continue;
+
+        for (auto& slot : group)
+        {
+            if (slot.bOneShot)
+                continue;
+
+            CGameObject* pObj = slot.pEffect;
+            if (!pObj || pObj->Is_Active())
+                continue;
+
+            //   ߻ ̹   ä ΰ  ֱ( )  ߻
+            if (!CEmitter_Timer::Is_AliveOnResume(slot.fElapsed, slot.fLifeTime))
+                continue;
+
+            // Ʈ  ð ű  API Ƿ ó ( ߻  )
+            pObj->Set_Active(true);
+
+            Apply_Effect_Transform(pObj, slot.bDecal, nullptr, nullptr);
+            Play_Effect(pObj, slot.bDecal);
+        }
+    }
+}
+
 HRESULT CEmitter::LoadEffects_FromFile(const _wstring& wsTag, const _wstring& wsFilePath)
 {
     // ̹ ε ׷̸ ŵ
@@ -110,6 +204,9 @@ HRESULT CEmitter::LoadEffects_FromFile(const _wstring& wsTag, const _wstring& ws
     
     auto& group = m_EffectGroups[wsTag];
     group.bGroupEnabled = false;
+
+    //  ӽ÷    ȮǸ Ʒ   
+    vector<POOL_DESC> Slots;
     
     CGameObject* pOwner = Get_Owner();
     auto* pCharacter = dynamic_cast<CCharacter*>(pOwner);
@@ -149,7 +246,7 @@ HRESULT CEmitter::LoadEffects_FromFile(const _wstring& wsTag, const _wstring& ws
                 }
             }
 
-            group.persistent.push_back(Make_PoolDesc(pChild, j));
+            Slots.push_back(Make_PoolDesc(pChild, j));
         }
     }
 
@@ -182,7 +279,7 @@ HRESULT CEmitter::LoadEffects_FromFile(const _wstring& wsTag, const _wstring& ws
                 }
             }
 
-            group.persistent.push_back(Make_PoolDesc(pChild, j));
+            Slots.push_back(Make_PoolDesc(pChild, j));
         }
     }
 
@@ -198,12 +295,18 @@ HRESULT CEmitter::LoadEffects_FromFile(const _wstring& wsTag, const _wstring& ws
 
         CGameObject* pObj = nullptr;
         if (FAILED(CGameInstance::GetInstance()->Add_GameObject(iPrototypeLevel, wsPrototypeTag, iCurLevel, wsLayerTag, &pObj, &j)))
+        {
+            // ̹  Ǯ ׷쿡 
+            Commit_Slots(group, Slots);
             return E_FAIL;
+        }
 
         if (pObj)
-            group.persistent.push_back(Make_PoolDesc(pObj, j));
+            Slots.push_back(Make_PoolDesc(pObj, j));
     }
 
+    Commit_Slots(group, Slots);
+
 	return S_OK;
 }
 
@@ -219,7 +322,7 @@ void CEmitter::Trigger(const _wstring& wsTag, const _vector* pPosition, const _v
     // ׷ Ȱȭ
     group.bGroupEnabled = true;
 
-    for (auto& slot : group.persistent)
+    for (auto& slot : group)
     {
         CGameObject* pObj = slot.pEffect;
         if (!pObj || pObj->Is_Active())
@@ -228,8 +331,8 @@ void CEmitter::Trigger(const _wstring& wsTag, const _vector* pPosition, const _v
         pObj->Set_Active(true);
 
         // Ȱȭ , ġ ̳   ʿϴٸ
-        Apply_Effect_Transform(pObj, pPosition, pDirection);
-        Play_Effect(pObj);
+        Apply_Effect_Transform(pObj, slot.bDecal, pPosition, pDirection);
+        Play_Effect(pObj, slot.bDecal);
 
         // Trigger ȣ   
         slot.fElapsed = 0.f;
@@ -246,7 +349,7 @@ void CEmitter::Stop_Trigger(const _wstring& wsTag)
     auto& group = iter->second;
     group.bGroupEnabled = false;
 
-    for (auto& slot : group.persistent)
+    for (auto& slot : group)
     {
         if (slot.pEffect)
         {
@@ -259,9 +362,14 @@ void CEmitter::Stop_Trigger(const _wstring& wsTag)
 // Ǯ Ʈ Ȱȭ Լ
 CGameObject* CEmitter::ActivateFromPool(SPAWN_GROUP& group, const _wstring& wsObjTag, const _vector* pPosition, const _vector* pDirection)
 {
-    for (auto& slot : group.persistent)
+    // ڿ   ± ε 
+    _ushort iTagIndex = Find_TagIndex(wsObjTag);
+    if (iTagIndex == NO_TAG)
+        return nullptr;
+
+    for (auto& slot : group)
     {
-        if (slot.wsObjectTag != wsObjTag)
+        if (slot.iTagIndex != iTagIndex)
             continue;
 
         auto* pObj = slot.pEffect;
@@ -272,8 +380,8 @@ CGameObject* CEmitter::ActivateFromPool(SPAWN_GROUP& group, const _wstring& wsOb
 
         pObj->Set_Active(true);
 
-        Apply_Effect_Transform(pObj, pPosition, pDirection);
-        Play_Effect(pObj);
+        Apply_Effect_Transform(pObj, slot.bDecal, pPosition, pDirection);
+        Play_Effect(pObj, slot.bDecal);
 
         return pObj;
     }
@@ -283,51 +391,173 @@ CGameObject* CEmitter::ActivateFromPool(SPAWN_GROUP& group, const _wstring& wsOb
 }
 
 void CEmitter::Decal(const _wstring& wsGroupTag, const _vector* pPos, _float fRadius, const _vector* pDir)
+{
+    //    ġ 1 
+    SCATTER_DESC tDesc = {};
+    tDesc.eType = SCATTER_DISK;
+    tDesc.iCount = 1;
+    tDesc.fRadius = fRadius;
+
+    Scatter_Decals(wsGroupTag, pPos, tDesc, pDir);
+}
+
+_uint CEmitter::Scatter_Decals(const _wstring& wsGroupTag, const _vector* pCenter, const SCATTER_DESC& tDesc, const _vector* pDir)
 {
     auto iter = m_EffectGroups.find(wsGroupTag);
-    if (iter == m_EffectGroups.end())
-        return;
+    if (iter == m_EffectGroups.end() || tDesc.iCount == 0)
+        return 0;
 
-    //    ġ 
-    _vector vSpawnPos = XMVectorZero();
-    const _vector* pPosArg = nullptr;
-    if (pPos)
+    // Ȱ  N   ĵ 
+    m_ScatterSlots.clear();
+    for (auto& slot : iter->second)
     {
-        _float2 vUnit = Random_OnCircle();
-        _float  fDist = Random(0.f, fRadius);
-        _vector vOffset = XMVectorSet(vUnit.x * fDist, 0.f, vUnit.y * fDist, 0.f);
-        vSpawnPos = *pPos + vOffset;
-        pPosArg = &vSpawnPos;
+        if (!slot.pEffect || slot.pEffect->Is_Active())
+            continue;
+
+        m_ScatterSlots.push_back(&slot);
+        if (m_ScatterSlots.size() == tDesc.iCount)
+            break;
     }
 
-    auto& pool = iter->second.persistent;
-    for (auto& slot : pool)
+    if (m_ScatterSlots.empty())
+        return 0;
+
+    //  ŭ   (Ƽ ڸ      )
+    _uint iNumSpawn = (_uint)m_ScatterSlots.size();
+    if (pCenter)
     {
-        auto* pObj = slot.pEffect;
-        if (!pObj || pObj->Is_Active())
-            continue;
+        SCATTER_DESC tReserved = tDesc;
+        tReserved.iCount = iNumSpawn;
+
+        Make_ScatterOffsets(tReserved, pDir, m_ScatterOffsets);
+        iNumSpawn = min(iNumSpawn, (_uint)m_ScatterOffsets.size());
+    }
+
+    //  ȸ  Į Ƿ   
+    AXIS_ANGLE tDecalRotation = {}, tEffectRotation = {};
+    _bool bRotate = pDir && Make_AxisAngle(XMVectorSet(0.f, 0.f, 1.f, 0.f), *pDir, tDecalRotation);
+    if (bRotate)
+        Make_AxisAngle(XMVectorSet(0.f, 1.f, 0.f, 0.f), *pDir, tEffectRotation);
+
+    for (_uint i = 0; i < iNumSpawn; ++i)
+    {
+        POOL_DESC& slot = *m_ScatterSlots[i];
+        CGameObject* pObj = slot.pEffect;
 
         pObj->Set_Active(true);
 
-        if (auto* pDecal = dynamic_cast<CEffect_Decal*>(pObj))
+        const AXIS_ANGLE* pRotation = bRotate ? (slot.bDecal ? &tDecalRotation : &tEffectRotation) : nullptr;
+
+        //  Į ġ θ Ͽ ӵǹǷ ⸸
+        _bool bSocket = slot.bDecal && static_cast<CEffect_Decal*>(pObj)->Is_UseSocket();
+        if (pCenter && !bSocket)
         {
-            //  Į ġ θ Ͽ ӵǹǷ ⸸
-            if (pDecal->Is_UseSocket())
-                Apply_Effect_Transform(pObj, nullptr, pDir);
-            else
-                Apply_Effect_Transform(pObj, pPosArg, pDir);
+            _vector vSpawnPos = *pCenter + XMVectorSet(m_ScatterOffsets[i].x, 0.f, m_ScatterOffsets[i].y, 0.f);
+            Apply_Effect_Pose(pObj, slot.bDecal, &vSpawnPos, pRotation);
         }
 
         else
         {
-            Apply_Effect_Transform(pObj, pPosArg, pDir);
+            Apply_Effect_Pose(pObj, slot.bDecal, nullptr, pRotation);
         }
 
-        Play_Effect(pObj);
+        Play_Effect(pObj, slot.bDecal);
 
         slot.fElapsed = 0.f;
+    }
+
+    return iNumSpawn;
+}
+
+void CEmitter::Set_RandomSeed(_uint iSeed)
+{
+    //  õ峢 Ʈ  
+    m_iRandomState = (iSeed + 1u) * 0x9E3779B9u;
+    if (m_iRandomState == 0)
+        m_iRandomState = 0x6D2B79F5u;
+}
+
+_float CEmitter::Random_Stream()
+{
+    m_iRandomState ^= m_iRandomState << 13;
+    m_iRandomState ^= m_iRandomState >> 17;
+    m_iRandomState ^= m_iRandomState << 5;
+
+    return _float(m_iRandomState >> 8) * (1.f / 16777216.f);
+}
+
+void CEmitter::Make_ScatterOffsets(const SCATTER_DESC& tDesc, const _vector* pDir, vector<_float2>& Offsets)
+{
+    Offsets.clear();
+
+    const _float fRadius = max(tDesc.fRadius, 0.f);
+
+    //   (XZ  ),    ü
+    SCATTER_TYPE eType = tDesc.eType;
+    _float fBaseAngle = 0.f;
+    if (eType == SCATTER_CONE)
+    {
+        _float3 vDir = {};
+        if (pDir)
+            XMStoreFloat3(&vDir, *pDir);
+
+        if (vDir.x * vDir.x + vDir.z * vDir.z < 1e-8f)
+            eType = SCATTER_DISK;
+        else
+            fBaseAngle = atan2f(vDir.z, vDir.x);
+    }
+
+    //  յ (sqrt) ߽  
+    auto Sample = [&]() -> _float2
+        {
+            _float fAngle = (eType == SCATTER_CONE)
+                ? fBaseAngle + (Random_Stream() * 2.f - 1.f) * tDesc.fConeAngle
+                : Random_Stream() * XM_2PI;
+            _float fDist = fRadius * sqrtf(Random_Stream());
+
+            return _float2(cosf(fAngle) * fDist, sinf(fAngle) * fDist);
+        };
+
+    if (eType != SCATTER_POISSON)
+    {
+        for (_uint i = 0; i < tDesc.iCount; ++i)
+            Offsets.push_back(Sample());
+
+        return;
+    }
+
+    // Ƽ ũ: Ʈ , ּ Ÿ  Ű   
+    _float fMinDist = tDesc.fMinDistance;
+    if (fMinDist <= 0.f)
+        fMinDist = fRadius * sqrtf(1.6f / _float(tDesc.iCount)); //    40% ä 
+    const _float fMinDistSq = fMinDist * fMinDist;
+    const _uint iMaxAttempts = 30;
+
+    eType = SCATTER_DISK;
+    for (_uint i = 0; i < tDesc.iCount; ++i)
+    {
+        for (_uint iAttempt = 0; iAttempt < iMaxAttempts; ++iAttempt)
+        {
+            _float2 vCandidate = Sample();
+
+            _bool bValid = true;
+            for (auto& vOffset : Offsets)
+            {
+                _float fDX = vOffset.x - vCandidate.x;
+                _float fDY = vOffset.y - vCandidate.y;
+                if (fDX * fDX + fDY * fDY < fMinDistSq)
+                {
+                    bValid = false;
+                    break;
+                }
+            }
 
-        break;
+            if (bValid)
+            {
+                Offsets.push_back(vCandidate);
+                break;
+            }
+        }
     }
 }
 
@@ -347,15 +577,72 @@ void CEmitter::Set_SpawnGroupInterval(const _wstring& wsGroupTag, _float fNewInt
 
     auto& group = iter->second;
 
-    for (auto& slot : group.persistent)
+    for (auto& slot : group)
     {
         slot.fInterval = fNewInterval;
         slot.fElapsed = min(slot.fElapsed, slot.fInterval);
     }
 }
 
+CEmitter::MEMORY_STATS CEmitter::Get_MemoryStats() const
+{
+    MEMORY_STATS tStats = {};
+    tStats.iNumEmitters = 1;
+    tStats.iNumGroups = (_uint)m_EffectGroups.size();
+    tStats.iSlotBytes = sizeof(POOL_DESC);
+    tStats.iNumTags = (_uint)m_ObjectTags.size();
+
+    const size_t iInlineCapacity = _wstring().capacity();
+    for (auto& wsTag : m_ObjectTags)
+    {
+        if (wsTag.capacity() > iInlineCapacity)
+            tStats.iTagHeapBytes += (wsTag.capacity() + 1) * sizeof(_wstring::value_type);
+    }
+    tStats.iNumArenaBlocks = m_Arena.Get_NumBlocks();
+    tStats.iArenaBytesUsed = m_Arena.Get_BytesUsed();
+    tStats.iArenaBytesReserved = m_Arena.Get_BytesReserved();
+
+    for (auto& [_, group] : m_EffectGroups)
+        tStats.iNumSlots += group.iNumSlots;
+
+    return tStats;
+}
+
+HRESULT CEmitter::Save_Snapshot(vector<_byte>& Out) const
+{
+    CEmitter_Snapshot::Save(m_EffectGroups, m_iRandomState, Out);
+
+    return S_OK;
+}
+
+HRESULT CEmitter::Load_Snapshot(const _byte* pData, size_t iSize)
+{
+    _uint iRandomState = m_iRandomState;
+    if (FAILED(CEmitter_Snapshot::Load(pData, iSize, m_EffectGroups, iRandomState)))
+        return E_FAIL;
+
+    m_iRandomState = iRandomState ? iRandomState : 0x6D2B79F5u;
+
+    return S_OK;
+}
+
 // Ʈ  ġ ȸ  , ϴ Լ
-void CEmitter::Apply_Effect_Transform(CGameObject* pObj, const _vector* pPosition, const _vector* pDirection)
+void CEmitter::Apply_Effect_Transform(CGameObject* pObj, _bool bDecal, const _vector* pPosition, const _vector* pDirection)
+{
+    // Į +Z( ), Ϲ Ʈ +Y ǥ  ȸ
+    AXIS_ANGLE tRotation = {};
+    _bool bRotate = false;
+
+    if (pDirection)
+    {
+        _vector vSrc = bDecal ? XMVectorSet(0.f, 0.f, 1.f, 0.f) : XMVectorSet(0.f, 1.f, 0.f, 0.f);
+        bRotate = Make_AxisAngle(vSrc, *pDirection, tRotation);
+    }
+
+    Apply_Effect_Pose(pObj, bDecal, pPosition, bRotate ? &tRotation : nullptr);
+}
+
+void CEmitter::Apply_Effect_Pose(CGameObject* pObj, _bool bDecal, const _vector* pPosition, const AXIS_ANGLE* pRotation)
 {
     if (!pObj)
         return;
@@ -372,124 +659,93 @@ void CEmitter::Apply_Effect_Transform(CGameObject* pObj, const _vector* pPositio
         bIsDirty = true;
     }
 
-    if (pDirection)
+    if (pRotation)
     {
-        const _float fEpsilon = 1e-6f;
-
-        _vector vDir = *pDirection;
-        
-        if (XMVectorGetX(XMVector3LengthSq(vDir)) > fEpsilon * fEpsilon)
+        //  Į  ȸ 
+        if (bDecal && static_cast<CEffect_Decal*>(pObj)->Is_UseSocket())
         {
-            vDir = XMVector3Normalize(vDir);
-
-            if (auto* pDecal = dynamic_cast<CEffect_Decal*>(pObj))
-            {
-                _vector vSrc = XMVectorSet(0.f, 0.f, 1.f, 0.f);
-
-                _float fDot = XMVectorGetX(XMVector3Dot(vSrc, vDir));
-                fDot = clamp(fDot, -1.f, 1.f);
-
-                _vector vAxis = XMVector3Cross(vSrc, vDir);
-                _float fAxisLenSq = XMVectorGetX(XMVector3LengthSq(vAxis));
-                _float fAngle = 0.f;
-
-                if (fAxisLenSq < fEpsilon * fEpsilon)
-                {
-                    if (fDot > 0.999999f)
-                    {
-                        // 0  ȸ X
-                        fAngle = 0.f;
-                        vAxis = XMVectorSet(1.f, 0.f, 0.f, 0.f); //  
-                    }
-
-                    else
-                    {
-                        // 180 vSrc   
-                        vAxis = XMVector3Orthogonal(vSrc);
-                        vAxis = XMVector3Normalize(vAxis);
-                        fAngle = XM_PI;
-                    }
-                }
+            static_cast<CEffect_Decal*>(pObj)->Set_OffsetRotationAxisAngle(pRotation->vAxis, pRotation->fAngle);
+        }
 
-                else
-                {
-                    vAxis = XMVector3Normalize(vAxis);
-                    fAngle = acosf(fDot);
-                }
+        else
+        {
+            pTransform->Rotation(XMLoadFloat3(&pRotation->vAxis), pRotation->fAngle);
+        }
 
-                if (pDecal->Is_UseSocket())
-                {
-                    //  Į  ȸ 
-                    _float3 vAxis3;
-                    XMStoreFloat3(&vAxis3, vAxis);
-                    pDecal->Set_OffsetRotationAxisAngle(vAxis3, fAngle);
-                    bIsDirty = true;
-                }
+        bIsDirty = true;
+    }
 
-                else
-                {
-                    pTransform->Rotation(vAxis, fAngle);
-                    bIsDirty = true;
-                }
-            }
+    if (bIsDirty)
+        pTransform->Update(0.f, pObj);
+}
 
-            else
-            {
-                // Į ƴ Ϲ Ʈ
-                _vector vSrc = XMVectorSet(0.f, 1.f, 0.f, 0.f);
+// vSrc(ȭ  ) vDirection  /,  ̰ 0̸ false
+_bool CEmitter::Make_AxisAngle(_fvector vSrc, _fvector vDirection, AXIS_ANGLE& tOut)
+{
+    const _float fEpsilon = 1e-6f;
 
-                _float fDot = XMVectorGetX(XMVector3Dot(vSrc, vDir));
-                fDot = clamp(fDot, -1.f, 1.f);
+    if (XMVectorGetX(XMVector3LengthSq(vDirection)) <= fEpsilon * fEpsilon)
+        return false;
 
-                _vector vAxis = XMVector3Cross(vSrc, vDir);
-                _float fAxisLenSq = XMVectorGetX(XMVector3LengthSq(vAxis));
-                _float fAngle = 0.f;
+    _vector vDir = XMVector3Normalize(vDirection);
 
-                if (vAxisLenSq < fEpsilon * fEpsilon)
-                {
-                    if (fDot > 0.999999f)
-                    {
-                        fAngle = 0.f;
-                        vAxis = XMVectorSet(1.f, 0.f, 0.f, 0.f);
-                    }
+    _float fDot = XMVectorGetX(XMVector3Dot(vSrc, vDir));
+    fDot = clamp(fDot, -1.f, 1.f);
 
-                    else
-                    {
-                        vAxis = XMVector3Orthogonal(vSrc);
-                        vAxis = XMVector3Normalize(vAxis);
-                        fAngle = XM_PI;
-                    }
-                }
+    _vector vAxis = XMVector3Cross(vSrc, vDir);
+    _float fAxisLenSq = XMVectorGetX(XMVector3LengthSq(vAxis));
+    _float fAngle = 0.f;
 
-                else
-                {
-                    vAxis = XMVector3Normalize(vAxis);
-                    fAngle = acosf(fDot);
-                }
+    if (fAxisLenSq < fEpsilon * fEpsilon)
+    {
+        if (fDot > 0.999999f)
+        {
+            // 0  ȸ X
+            fAngle = 0.f;
+            vAxis = XMVectorSet(1.f, 0.f, 0.f, 0.f); //  
+        }
 
-                pTransform->Rotation(vAxis, fAngle);
-                bIsDirty = true;
-            }
+        else
+        {
+            // 180 vSrc   
+            vAxis = XMVector3Orthogonal(vSrc);
+            vAxis = XMVector3Normalize(vAxis);
+            fAngle = XM_PI;
         }
     }
 
-    if (bIsDirty)
-        pTransform->Update(0.f, pObj);
+    else
+    {
+        vAxis = XMVector3Normalize(vAxis);
+        fAngle = acosf(fDot);
+    }
+
+    XMStoreFloat3(&tOut.vAxis, vAxis);
+    tOut.fAngle = fAngle;
+
+    return true;
 }
 
 // Ʈ/ƼŬ б   Լ
-void CEmitter::Play_Effect(CGameObject* pObj)
+void CEmitter::Play_Effect(CGameObject* pObj, _bool bDecal)
 {
     if (!pObj)
         return;
 
-    if (auto* pEffect = dynamic_cast<CEffectObject*>(pObj))
+    // Į CEffectObject Ļ̹Ƿ ε  Ǻ  ٷ 
+    if (bDecal)
+    {
+        static_cast<CEffectObject*>(pObj)->Play_Effect(true);
+    }
+
+    else if (auto* pEffect = dynamic_cast<CEffectObject*>(pObj))
     {
         pEffect->Play_Effect(true);
     }
 
     else if (auto* pParticle = dynamic_cast<CParticleObject*>(pObj))
     {
+        //  ü ʱȭ,  νϽ ٽ ¿ δ CParticle_Respawn::Respawn_Dead (  Map Լ ʿ)
         if (auto* pBuffer = pParticle->Find_Component<CVIBuffer_Point_Instancing>(CLASS_NAME(CVIBuffer)))
             pBuffer->Update_IPBuffer();
         
@@ -497,13 +753,15 @@ void CEmitter::Play_Effect(CGameObject* pObj)
     }
 }
 
-POOL_DESC CEmitter::Make_PoolDesc(CGameObject* pObj, const json& j)
+CEmitter::POOL_DESC CEmitter::Make_PoolDesc(CGameObject* pObj, const json& j)
 {
     POOL_DESC pd;
     pd.pEffect = pObj;
-    pd.wsObjectTag = Get_ObjectTag_FromJson(j);
+    pd.iTagIndex = Intern_Tag(Get_ObjectTag_FromJson(j));
+    pd.bDecal = dynamic_cast<CEffect_Decal*>(pObj) != nullptr;
     pd.bOneShot = j.value("bOneShot", false);
     pd.fInterval = j.value("fInterval", j.value("fLifeTime", 1.f));
+    pd.fLifeTime = j.value("fLifeTime", pd.fInterval);
     pd.fElapsed = pd.fInterval; // ʿ  Trigger ȣ  0 
 
     return pd;
@@ -519,6 +777,38 @@ _wstring CEmitter::Get_ObjectTag_FromJson(const json& j)
     return L"";
 }
 
+_ushort CEmitter::Intern_Tag(const _wstring& wsTag)
+{
+    _ushort iIndex = Find_TagIndex(wsTag);
+    if (iIndex != NO_TAG)
+        return iIndex;
+
+    if (m_ObjectTags.size() >= NO_TAG)
+        return NO_TAG;
+
+    m_ObjectTags.push_back(wsTag);
+
+    return _ushort(m_ObjectTags.size() - 1);
+}
+
+_ushort CEmitter::Find_TagIndex(const _wstring& wsTag) const
+{
+    // ̹ ϳ ±״   ̶  Ž
+    for (size_t i = 0; i < m_ObjectTags.size(); ++i)
+    {
+        if (m_ObjectTags[i] == wsTag)
+            return _ushort(i);
+    }
+
+    return NO_TAG;
+}
+
+void CEmitter::Commit_Slots(EFFECT_GROUP& group, const vector<POOL_DESC>& Slots)
+{
+    group.pSlots = m_Arena.Copy(Slots.data(), (_uint)Slots.size());
+    group.iNumSlots = (_uint)Slots.size();
+}
+
 CEmitter* CEmitter::Create(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
 {
 	CEmitter* pInstance = new CEmitter(pDevice, pContext);
@@ -548,4 +838,9 @@ CComponent* CEmitter::Clone(void* pArg, CGameObject* pOwner)
 void CEmitter::Free()
 {
 	__super::Free();
+
+    //  ޸𸮴 Ʒ ° ȯ
+    m_EffectGroups.clear();
+    m_Arena.Release();
+    m_ObjectTags.clear();
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Component.h"
+#include "Emitter_Arena.h"
 
 BEGIN(Engine)
 class CAlphaObject;
@@ -10,21 +11,87 @@ BEGIN(Client)
 class CEmitter : public CComponent
 {
 public:
+	static constexpr _ushort NO_TAG = 0xFFFF;
+
+	//  POD (± ڿ ̹ ± ̺ εθ )
 	struct POOL_DESC
 	{
 		CGameObject*		pEffect = { nullptr }; // Pool
-		_wstring			wsObjectTag;
-
-		_bool				bOneShot = { false }; // ֱ  ʿ䰡  Ʈ
 
 		_float				fInterval = {};
 		_float				fElapsed = {};
+		_float				fLifeTime = {};		// Ʈ    (   )
+
+		_ushort				iTagIndex = { NO_TAG }; // m_ObjectTags ε
+		_bool				bOneShot = { false }; // ֱ  ʿ䰡  Ʈ
+		_bool				bDecal = { false }; // ε    Ǻ(CEffect_Decal)
 	};
+	static_assert(sizeof(POOL_DESC) <= 32, "POOL_DESC must stay compact");
 
 	struct EFFECT_GROUP
 	{
-		vector<POOL_DESC> persistent; // ׷쿡 ԵǴ Ʈ Ǯ  ֱ Ķ͸ 
+		POOL_DESC* pSlots = nullptr; // ׷쿡 ԵǴ Ʈ Ǯ  ֱ Ķ(̹ Ʒ )
+		_uint iNumSlots = 0;
 		_bool bGroupEnabled = false; // ׷ Ȱȭ ÷
+
+		POOL_DESC* begin() const { return pSlots; }
+		POOL_DESC* end() const { return pSlots + iNumSlots; }
+	};
+
+	// Į Ѹ (XZ )
+	enum SCATTER_TYPE { SCATTER_DISK, SCATTER_POISSON, SCATTER_CONE, SCATTER_END };
+
+	struct SCATTER_DESC
+	{
+		SCATTER_TYPE		eType = { SCATTER_DISK };
+		_uint				iCount = { 1 };
+		_float				fRadius = { 1.f };
+		_float				fMinDistance = {};		// POISSON:   ּ Ÿ(0̸ ݰ  )
+		_float				fConeAngle = { XM_PIDIV4 };	// CONE: pDir  ݰ()
+	};
+
+	//   ǥ   /(Ѹ⿡ ȣ   ؼ )
+	struct AXIS_ANGLE
+	{
+		_float3				vAxis = {};
+		_float				fAngle = {};
+	};
+
+	//  ̹ : ڰ ȭ ̰ų ָ ֱ Ʈ   ʰ Ÿ̸Ӹ 
+	struct SIGNIFICANCE_DESC
+	{
+		_float				fMaxDistance = {};		// ī޶ Ÿ (0̸ Ÿ  X)
+		_float				fBoundsRadius = { 1.f };	// ü    
+		_bool				bUseFrustum = { true };
+	};
+	using SIGNIFICANCE_FUNC = function<_bool(CGameObject* pOwner)>;
+
+	//  ε   ̹  +=  ջؼ (  ޸ 񱳿)
+	struct MEMORY_STATS
+	{
+		_uint				iNumEmitters = {};
+		_uint				iNumGroups = {};
+		_uint				iNumSlots = {};
+		_uint				iSlotBytes = {};		// sizeof(POOL_DESC)
+		_uint				iNumTags = {};
+		size_t				iTagHeapBytes = {};		// SSO Ѿ   ± ڿ 뷮
+		_uint				iNumArenaBlocks = {};	//    Ҵ Ƚ
+		size_t				iArenaBytesUsed = {};
+		size_t				iArenaBytesReserved = {};
+
+		MEMORY_STATS&		operator+=(const MEMORY_STATS& rhs)
+		{
+			iNumEmitters += rhs.iNumEmitters;
+			iNumGroups += rhs.iNumGroups;
+			iNumSlots += rhs.iNumSlots;
+			iSlotBytes = rhs.iSlotBytes;
+			iNumTags += rhs.iNumTags;
+			iTagHeapBytes += rhs.iTagHeapBytes;
+			iNumArenaBlocks += rhs.iNumArenaBlocks;
+			iArenaBytesUsed += rhs.iArenaBytesUsed;
+			iArenaBytesReserved += rhs.iArenaBytesReserved;
+			return *this;
+		}
 	};
 
 private:
@@ -46,20 +113,68 @@ public:
 
 	CGameObject*			ActivateFromPool(EFFECT_GROUP& group, const _wstring& wsObjTag, const _vector* pPosition = nullptr, const _vector* pDirection = nullptr);
 	void					Decal(const _wstring& wsGroupTag, const _vector* pPos, _float fRadius, const _vector* pDir = nullptr);
+	// ׷쿡 Ȱ  N     ġ,    ȯ
+	_uint					Scatter_Decals(const _wstring& wsGroupTag, const _vector* pCenter, const SCATTER_DESC& tDesc, const _vector* pDir = nullptr);
+	// ̹   Ʈ õ( õ =  Ѹ )
+	void					Set_RandomSeed(_uint iSeed);
 
 	_bool                   Is_GroupEnabled(const _wstring& wsTag) const;
 	void					Set_SpawnGroupInterval(const _wstring& wsGroupTag, _float fNewInterval);
 
+	MEMORY_STATS			Get_MemoryStats() const;
+
+	//  Լ  Ÿ/ü  
+	void					Enable_Significance(const SIGNIFICANCE_DESC& tDesc, SIGNIFICANCE_FUNC Test = nullptr);
+	void					Disable_Significance();
+	_bool					Is_Virtual() const { return m_bVirtual; }
+	// ̹  /  ǳʶ Ȱȭ Ƚ
+	_uint					Get_SkippedActivations() const { return m_iSkippedThisFrame; }
+	_uint64					Get_TotalSkippedActivations() const { return m_iSkippedTotal; }
+
+	// ׷ Ȱ ,  ֱ/ ð,  Ʈ ̳ʸ  /
+	// Ǯ Ʈ ü  Ƿ  Ʈ  ε ̹Ϳ (׷ ± +   Ī)
+	HRESULT					Save_Snapshot(vector<_byte>& Out) const;
+	HRESULT					Load_Snapshot(const _byte* pData, size_t iSize);
+
 private:
-	void					Apply_Effect_Transform(CGameObject* pObj, const _vector* pPosition, const _vector* pDirection);
-	void					Play_Effect(CGameObject* pObj);
+	// bDecal Կ ε   ( ο dynamic_cast  б)
+	void					Apply_Effect_Transform(CGameObject* pObj, _bool bDecal, const _vector* pPosition, const _vector* pDirection);
+	void					Apply_Effect_Pose(CGameObject* pObj, _bool bDecal, const _vector* pPosition, const AXIS_ANGLE* pRotation);
+	static _bool			Make_AxisAngle(_fvector vSrc, _fvector vDirection, AXIS_ANGLE& tOut);
+	void					Play_Effect(CGameObject* pObj, _bool bDecal);
 
-	static POOL_DESC		Make_PoolDesc(CGameObject* pObj, const json& j);
+	POOL_DESC				Make_PoolDesc(CGameObject* pObj, const json& j);
 	static _wstring			Get_ObjectTag_FromJson(const json& j);
 
+	_ushort					Intern_Tag(const _wstring& wsTag);
+	_ushort					Find_TagIndex(const _wstring& wsTag) const;
+	void					Commit_Slots(EFFECT_GROUP& group, const vector<POOL_DESC>& Slots);
+
+	_bool					Is_Significant();
+	//  ¿ :  () ߻     Ʈ  
+	void					Resume_FromVirtual();
+
+	_float					Random_Stream();	// [0, 1)
+	void					Make_ScatterOffsets(const SCATTER_DESC& tDesc, const _vector* pDir, vector<_float2>& Offsets);
+
 private:
 	map<_wstring, EFFECT_GROUP>	m_EffectGroups;
 
+	// ׷  迭 Ʒ ε    Ҵ, Free ϰ 
+	CEmitter_Arena			m_Arena;
+	vector<_wstring>		m_ObjectTags;	// Ǯ Ʈ ± ̺
+
+	_bool					m_bUseSignificance = { false };
+	SIGNIFICANCE_DESC		m_tSignificance = {};
+	SIGNIFICANCE_FUNC		m_SignificanceTest = { nullptr };
+	_bool					m_bVirtual = { false };
+	_uint					m_iSkippedThisFrame = {};
+	_uint64					m_iSkippedTotal = {};
+
+	_uint					m_iRandomState = { 0x6D2B79F5u };	// xorshift32 (0 )
+	vector<POOL_DESC*>		m_ScatterSlots;		// Ѹ ۾( ȣ )
+	vector<_float2>			m_ScatterOffsets;
+
 public:
 	static CEmitter* Create(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
 	virtual CComponent* Clone(void* pArg, class CGameObject* pOwner) override;
@@ -0,0 +1,38 @@
+#include "Emitter_Arena.h"
+
+void* CEmitter_Arena::Allocate(size_t iBytes, size_t iAlign)
+{
+    if (iBytes == 0)
+        return nullptr;
+
+    size_t iAligned = (m_iOffset + iAlign - 1) & ~(iAlign - 1);
+
+    //   ϸ  (ū û  ũ)
+    if (m_Blocks.empty() || iAligned + iBytes > m_iBlockSize)
+    {
+        // new[]   ⺻ new (16) ϹǷ   ¸ 
+        m_iBlockSize = max(BLOCK_SIZE, iBytes);
+        m_Blocks.push_back(new _byte[m_iBlockSize]);
+        m_iBytesReserved += m_iBlockSize;
+
+        iAligned = 0;
+    }
+
+    void* pMemory = m_Blocks.back() + iAligned;
+    m_iOffset = iAligned + iBytes;
+    m_iBytesUsed += iBytes;
+
+    return pMemory;
+}
+
+void CEmitter_Arena::Release()
+{
+    for (auto& pBlock : m_Blocks)
+        delete[] pBlock;
+
+    m_Blocks.clear();
+    m_iOffset = 0;
+    m_iBlockSize = 0;
+    m_iBytesReserved = 0;
+    m_iBytesUsed = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Client_Defines.h"
+
+BEGIN(Client)
+
+// ̹  () Ҵ
+// ׷  迭ó ε     ̹Ϳ  ϴ ͸ 
+//    Release     ȯ
+class CEmitter_Arena final
+{
+public:
+	CEmitter_Arena() = default;
+	~CEmitter_Arena() { Release(); }
+
+	CEmitter_Arena(const CEmitter_Arena&) = delete;
+	CEmitter_Arena& operator=(const CEmitter_Arena&) = delete;
+
+public:
+	// iAlign 2 ŵ, 16 
+	void*					Allocate(size_t iBytes, size_t iAlign);
+
+	// Ʈ Ÿ 迭 纻 Ʒ (Ҹ ȣ )
+	template<typename T>
+	T*						Copy(const T* pSrc, _uint iCount)
+	{
+		static_assert(is_trivially_copyable_v<T> && is_trivially_destructible_v<T>, "arena only holds trivial types");
+
+		if (iCount == 0)
+			return nullptr;
+
+		T* pDst = static_cast<T*>(Allocate(sizeof(T) * iCount, alignof(T)));
+		memcpy(pDst, pSrc, sizeof(T) * iCount);
+
+		return pDst;
+	}
+
+	void					Release();
+
+	_uint					Get_NumBlocks() const { return (_uint)m_Blocks.size(); }
+	size_t					Get_BytesReserved() const { return m_iBytesReserved; }
+	size_t					Get_BytesUsed() const { return m_iBytesUsed; }
+
+private:
+	static constexpr size_t	BLOCK_SIZE = 4096;
+
+	vector<_byte*>			m_Blocks;
+	size_t					m_iOffset = {};			//     Ҵ ġ
+	size_t					m_iBlockSize = {};		//   ũ
+	size_t					m_iBytesReserved = {};
+	size_t					m_iBytesUsed = {};
+};
+
+END
@@ -0,0 +1,114 @@
+#pragma once
+#include "Client_Defines.h"
+#include "Snapshot_Stream.h"
+
+BEGIN(Client)
+
+// CEmitter  ( , ׷ Ȱȭ,  Ÿ̸) ̳ʸ 
+// ׷  map<_wstring, ׷>(׷: bGroupEnabled, iNumSlots, pSlots[i].fInterval/fElapsed/bOneShot)̸ ǹǷ
+// ̽/ Ʈ  ׽Ʈ  ڵ带 
+class CEmitter_Snapshot final
+{
+public:
+	static constexpr _uint		MAGIC = 'EMTS';
+	static constexpr _ushort	VERSION = 1;
+
+public:
+	template<typename GROUP_MAP>
+	static void		Save(const GROUP_MAP& Groups, _uint iRandomState, vector<_byte>& Out)
+	{
+		CSnapshot_Writer Writer(Out);
+		Writer.Begin(MAGIC, VERSION);
+
+		Writer.Write(iRandomState);
+		Writer.Write((_uint)Groups.size());
+
+		for (auto& [wsTag, group] : Groups)
+		{
+			Writer.Write_String(wsTag);
+			Writer.Write(group.bGroupEnabled);
+			Writer.Write(group.iNumSlots);
+
+			for (_uint iSlot = 0; iSlot < group.iNumSlots; ++iSlot)
+			{
+				Writer.Write(group.pSlots[iSlot].fInterval);
+				Writer.Write(group.pSlots[iSlot].fElapsed);
+				Writer.Write(group.pSlots[iSlot].bOneShot);
+			}
+		}
+
+		Writer.End();
+	}
+
+	//  ӽ÷ а  ڿ ݿ(߰ ߸  Ϻ ׷츸  ʵ)
+	//  ̹Ϳ  ׷̰ų   ٸ ׷ ǳʶ,   Groups/iRandomState ״
+	template<typename GROUP_MAP>
+	static HRESULT	Load(const _byte* pData, size_t iSize, GROUP_MAP& Groups, _uint& iRandomState)
+	{
+		using GROUP = typename GROUP_MAP::mapped_type;
+		using SLOT = remove_reference_t<decltype(*declval<GROUP&>().pSlots)>;
+
+		CSnapshot_Reader Reader(pData, iSize);
+		if (!Reader.Begin(MAGIC, VERSION))
+			return E_FAIL;
+
+		_uint iSavedRandomState = {}, iNumGroups = {};
+		if (!Reader.Read(iSavedRandomState) || !Reader.Read(iNumGroups))
+			return E_FAIL;
+
+		struct PENDING_SLOT
+		{
+			SLOT*		pSlot;
+			_float		fInterval;
+			_float		fElapsed;
+			_bool		bOneShot;
+		};
+
+		vector<pair<GROUP*, _bool>> PendingGroups;
+		vector<PENDING_SLOT> PendingSlots;
+
+		for (_uint i = 0; i < iNumGroups; ++i)
+		{
+			_wstring wsTag;
+			_bool bGroupEnabled = {};
+			_uint iNumSlots = {};
+			if (!Reader.Read_String(wsTag) || !Reader.Read(bGroupEnabled) || !Reader.Read(iNumSlots))
+				return E_FAIL;
+
+			auto iter = Groups.find(wsTag);
+			_bool bMatch = iter != Groups.end() && iter->second.iNumSlots == iNumSlots;
+
+			if (bMatch)
+				PendingGroups.emplace_back(&iter->second, bGroupEnabled);
+
+			for (_uint iSlot = 0; iSlot < iNumSlots; ++iSlot)
+			{
+				PENDING_SLOT tSaved = {};
+				if (!Reader.Read(tSaved.fInterval) || !Reader.Read(tSaved.fElapsed) || !Reader.Read(tSaved.bOneShot))
+					return E_FAIL;
+
+				if (bMatch)
+				{
+					tSaved.pSlot = &iter->second.pSlots[iSlot];
+					PendingSlots.push_back(tSaved);
+				}
+			}
+		}
+
+		for (auto& [pGroup, bGroupEnabled] : PendingGroups)
+			pGroup->bGroupEnabled = bGroupEnabled;
+
+		for (auto& tSaved : PendingSlots)
+		{
+			tSaved.pSlot->fInterval = tSaved.fInterval;
+			tSaved.pSlot->fElapsed = tSaved.fElapsed;
+			tSaved.pSlot->bOneShot = tSaved.bOneShot;
+		}
+
+		iRandomState = iSavedRandomState;
+
+		return S_OK;
+	}
+};
+
+END
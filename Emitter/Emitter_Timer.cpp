@@ -0,0 +1,21 @@
+#include "Emitter_Timer.h"
+
+_uint CEmitter_Timer::Advance_Virtual(_float& fElapsed, _float fInterval, _float fLifeTime, _float fTimeDelta)
+{
+    _float fPeriod = (fInterval > 0.f) ? fInterval : fLifeTime;
+    if (fPeriod <= 0.f)
+    {
+        fElapsed = 0.f;
+        return 0;
+    }
+
+    fElapsed += fTimeDelta;
+    if (fElapsed < fPeriod)
+        return 0;
+
+    // ( ߻   ð) ,  ̾ [0, fPeriod) 
+    _uint iNumFired = _uint(fElapsed / fPeriod);
+    fElapsed = fmodf(fElapsed, fPeriod);
+
+    return iNumFired;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Client_Defines.h"
+
+BEGIN(Client)
+
+//  ̹  Ÿ̸(ֱ/ ٷǷ CEmitter ׽Ʈ  ڵ带 )
+// fElapsed  () ߻   ð
+class CEmitter_Timer final
+{
+public:
+	//  ¿   , ǳʶ ߻ Ƚ ȯ
+	// ֱⰡ (fInterval <= 0)    ٷ ٽ Ƿ  ֱ  -> fElapsed ׻ ֱ ̸
+	static _uint			Advance_Virtual(_float& fElapsed, _float fInterval, _float fLifeTime, _float fTimeDelta);
+
+	//   ٽ :  ߻  Ʈ   ̸ true
+	//     ä ΰ  ֱ⿡  ߻
+	static _bool			Is_AliveOnResume(_float fElapsed, _float fLifeTime) { return fElapsed < fLifeTime; }
+};
+
+END
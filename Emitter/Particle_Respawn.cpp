@@ -0,0 +1,221 @@
+#include "Particle_Respawn.h"
+#include <emmintrin.h>
+
+namespace
+{
+    // κ õ л
+    _uint SplitMix32(_uint64& iState)
+    {
+        _uint64 z = (iState += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= (z >> 31);
+
+        _uint iResult = _uint(z);
+        return iResult ? iResult : 0x6D2B79F5u; // xorshift 0  
+    }
+
+    // 4 xorshift32
+    inline __m128i Next_Random(__m128i& vState)
+    {
+        vState = _mm_xor_si128(vState, _mm_slli_epi32(vState, 13));
+        vState = _mm_xor_si128(vState, _mm_srli_epi32(vState, 17));
+        vState = _mm_xor_si128(vState, _mm_slli_epi32(vState, 5));
+        return vState;
+    }
+
+    //  23Ʈ  -> [0, 1)
+    inline __m128 Random01(__m128i& vState)
+    {
+        __m128i vBits = _mm_or_si128(_mm_srli_epi32(Next_Random(vState), 9), _mm_set1_epi32(0x3F800000));
+        return _mm_sub_ps(_mm_castsi128_ps(vBits), _mm_set1_ps(1.f));
+    }
+
+    inline __m128 Random_Range(__m128i& vState, _float fMin, _float fMax)
+    {
+        return _mm_add_ps(_mm_set1_ps(fMin), _mm_mul_ps(Random01(vState), _mm_set1_ps(fMax - fMin)));
+    }
+
+    inline void Write(_byte* pVertex, _uint iOffset, const void* pSrc, size_t iSize)
+    {
+        if (iOffset != CParticle_Respawn::LAYOUT::NO_ELEMENT)
+            memcpy(pVertex + iOffset, pSrc, iSize);
+    }
+}
+
+void CParticle_Respawn::Respawn(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, const _uint* pIndices, _uint iCount, _uint iSeed, _float2* pLifeTimes)
+{
+    if (!pMapped || tLayout.iStride == 0 || iCount == 0)
+        return;
+
+    _byte* pBase = static_cast<_byte*>(pMapped);
+
+    _uint64 iSeedState = iSeed;
+    __m128i vState = _mm_set_epi32(SplitMix32(iSeedState), SplitMix32(iSeedState), SplitMix32(iSeedState), SplitMix32(iSeedState));
+
+    const __m128 vHalf = _mm_set1_ps(0.5f);
+    const __m128 vEpsilon = _mm_set1_ps(1e-6f);
+
+    alignas(16) _float fPosX[4], fPosY[4], fPosZ[4];
+    alignas(16) _float fVelX[4], fVelY[4], fVelZ[4];
+    alignas(16) _float fSpeed[4], fLife[4], fSize[4];
+
+    for (_uint i = 0; i < iCount; i += 4)
+    {
+        // ġ: ߽ +-  / 2
+        __m128 vPX = _mm_add_ps(_mm_set1_ps(tDesc.vCenter.x), _mm_mul_ps(_mm_sub_ps(Random01(vState), vHalf), _mm_set1_ps(tDesc.vRange.x)));
+        __m128 vPY = _mm_add_ps(_mm_set1_ps(tDesc.vCenter.y), _mm_mul_ps(_mm_sub_ps(Random01(vState), vHalf), _mm_set1_ps(tDesc.vRange.y)));
+        __m128 vPZ = _mm_add_ps(_mm_set1_ps(tDesc.vCenter.z), _mm_mul_ps(_mm_sub_ps(Random01(vState), vHalf), _mm_set1_ps(tDesc.vRange.z)));
+
+        // : ǹ -> ġ, ̰ 0̸ 
+        __m128 vDX = _mm_sub_ps(vPX, _mm_set1_ps(tDesc.vPivot.x));
+        __m128 vDY = _mm_sub_ps(vPY, _mm_set1_ps(tDesc.vPivot.y));
+        __m128 vDZ = _mm_sub_ps(vPZ, _mm_set1_ps(tDesc.vPivot.z));
+        __m128 vLenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vDX, vDX), _mm_mul_ps(vDY, vDY)), _mm_mul_ps(vDZ, vDZ));
+        __m128 vValid = _mm_cmpgt_ps(vLenSq, vEpsilon);
+        __m128 vInvLen = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(_mm_max_ps(vLenSq, vEpsilon)));
+
+        __m128 vSpeed = Random_Range(vState, tDesc.vSpeed.x, tDesc.vSpeed.y);
+        __m128 vScale = _mm_mul_ps(vInvLen, vSpeed);
+
+        _mm_store_ps(fPosX, vPX);
+        _mm_store_ps(fPosY, vPY);
+        _mm_store_ps(fPosZ, vPZ);
+        _mm_store_ps(fVelX, _mm_and_ps(vValid, _mm_mul_ps(vDX, vScale)));
+        _mm_store_ps(fVelY, _mm_or_ps(_mm_and_ps(vValid, _mm_mul_ps(vDY, vScale)), _mm_andnot_ps(vValid, vSpeed)));
+        _mm_store_ps(fVelZ, _mm_and_ps(vValid, _mm_mul_ps(vDZ, vScale)));
+        _mm_store_ps(fSpeed, vSpeed);
+        _mm_store_ps(fLife, Random_Range(vState, tDesc.vLifeTime.x, tDesc.vLifeTime.y));
+        _mm_store_ps(fSize, Random_Range(vState, tDesc.vSize.x, tDesc.vSize.y));
+
+        // νϽ  ̾ƿ ѷ 
+        _uint iLanes = min(4u, iCount - i);
+        for (_uint k = 0; k < iLanes; ++k)
+        {
+            _uint iInstance = pIndices ? pIndices[i + k] : i + k;
+            _byte* pVertex = pBase + size_t(iInstance) * tLayout.iStride;
+
+            _float4 vPosition = _float4(fPosX[k], fPosY[k], fPosZ[k], 1.f);
+            _float4 vVelocity = _float4(fVelX[k], fVelY[k], fVelZ[k], fSpeed[k]);
+            _float2 vLifeTime = _float2(fLife[k], 0.f);
+
+            Write(pVertex, tLayout.iPositionOffset, &vPosition, sizeof(_float4));
+            Write(pVertex, tLayout.iVelocityOffset, &vVelocity, sizeof(_float4));
+            Write(pVertex, tLayout.iLifeTimeOffset, &vLifeTime, sizeof(_float2));
+            Write(pVertex, tLayout.iSizeOffset, &fSize[k], sizeof(_float));
+
+            if (pLifeTimes)
+                pLifeTimes[iInstance] = vLifeTime;
+        }
+    }
+}
+
+shared_ptr<const vector<_byte>> CParticle_Respawn::Find_InitialState(const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed)
+{
+    _uint64 iKey = Hash_Desc(tLayout, tDesc, iNumInstances, iSeed);
+
+    auto iter = m_InitialStates.find(iKey);
+    if (iter != m_InitialStates.end())
+        return iter->second;
+
+    auto pState = make_shared<vector<_byte>>(size_t(tLayout.iStride) * iNumInstances, _byte(0));
+    Respawn(pState->data(), tLayout, tDesc, nullptr, iNumInstances, iSeed);
+
+    m_InitialStates.emplace(iKey, pState);
+
+    return pState;
+}
+
+HRESULT CParticle_Respawn::Restart_All(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed, _float2* pLifeTimes)
+{
+    if (!pMapped || tLayout.iStride == 0)
+        return E_FAIL;
+
+    auto pState = Find_InitialState(tLayout, tDesc, iNumInstances, iSeed);
+
+    // νϽ   (ȸ  ) ״ ΰ   Ҹ 
+    _byte* pDst = static_cast<_byte*>(pMapped);
+    const _byte* pSrc = pState->data();
+
+    for (_uint i = 0; i < iNumInstances; ++i)
+    {
+        _byte* pVertex = pDst + size_t(i) * tLayout.iStride;
+        const _byte* pInit = pSrc + size_t(i) * tLayout.iStride;
+
+        auto Copy = [&](_uint iOffset, size_t iSize)
+            {
+                if (iOffset != LAYOUT::NO_ELEMENT)
+                    memcpy(pVertex + iOffset, pInit + iOffset, iSize);
+            };
+
+        Copy(tLayout.iPositionOffset, sizeof(_float4));
+        Copy(tLayout.iVelocityOffset, sizeof(_float4));
+        Copy(tLayout.iLifeTimeOffset, sizeof(_float2));
+        Copy(tLayout.iSizeOffset, sizeof(_float));
+
+        //  纻 ĳ(CPU ޸) ,  Ұ  ̾ƿ̸   ·
+        if (pLifeTimes)
+        {
+            if (tLayout.iLifeTimeOffset != LAYOUT::NO_ELEMENT)
+                memcpy(&pLifeTimes[i], pInit + tLayout.iLifeTimeOffset, sizeof(_float2));
+            else
+                pLifeTimes[i] = _float2(0.f, 0.f);
+        }
+    }
+
+    return S_OK;
+}
+
+_uint CParticle_Respawn::Respawn_Dead(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, _float2* pLifeTimes, _uint iNumInstances, _uint iSeed)
+{
+    if (!pMapped || !pLifeTimes || tLayout.iStride == 0)
+        return 0;
+
+    // Map ۴ write-combined  ſ Ƿ CPU  纻θ 
+    m_DeadIndices.clear();
+    for (_uint i = 0; i < iNumInstances; ++i)
+    {
+        if (pLifeTimes[i].y >= pLifeTimes[i].x)
+            m_DeadIndices.push_back(i);
+    }
+
+    Respawn(pMapped, tLayout, tDesc, m_DeadIndices.data(), (_uint)m_DeadIndices.size(), iSeed, pLifeTimes);
+
+    return (_uint)m_DeadIndices.size();
+}
+
+_uint64 CParticle_Respawn::Hash_Desc(const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed)
+{
+    // FNV-1a 64
+    _uint64 iHash = 14695981039346656037ull;
+
+    auto Mix = [&iHash](const void* pData, size_t iSize)
+        {
+            const _ubyte* pBytes = static_cast<const _ubyte*>(pData);
+            for (size_t i = 0; i < iSize; ++i)
+            {
+                iHash ^= pBytes[i];
+                iHash *= 1099511628211ull;
+            }
+        };
+
+    Mix(&tLayout, sizeof(LAYOUT));
+    Mix(&tDesc, sizeof(INIT_DESC));
+    Mix(&iNumInstances, sizeof(_uint));
+    Mix(&iSeed, sizeof(_uint));
+
+    return iHash;
+}
+
+CParticle_Respawn* CParticle_Respawn::Create()
+{
+    return new CParticle_Respawn();
+}
+
+void CParticle_Respawn::Free()
+{
+    __super::Free();
+
+    m_InitialStates.clear();
+    m_DeadIndices.clear();
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Client_Defines.h"
+#include "Base.h"
+
+BEGIN(Client)
+
+// ƼŬ Ʈ ۿ νϽ  (ġ, ӵ, , ũ) 
+// Update_IPBufferó  ü ʱȭ ʰ, Map νϽ ۿ ٽ ¾ νϽ  
+// Map (WRITE_DISCARD/NO_OVERWRITE, write-combined)  θ ٷ,   CPU   纻(pLifeTimes) 
+//  SSE2 4 xorshift 4 ,  Ķ + õ  ׻ 
+// Ķ/õ尡  Ʈ    Һ  ¸ ؼ memcpy 
+//
+//  : CEmitter::Play_Effect ƼŬ б(pBuffer->Update_IPBuffer() ȣ)
+// CVIBuffer_Point_Instancing(,  Ʈ ) νϽ _float2(ִ, )  纻 
+// Map(NO_OVERWRITE) -> Respawn_Dead(pMapped, ...,  纻) -> Unmap ϴ Լ ߰ϸ  ȣ ü
+class CParticle_Respawn final : public CBase
+{
+public:
+	struct INIT_DESC
+	{
+		_float3		vCenter = {};
+		_float3		vRange = { 1.f, 1.f, 1.f };	// ߽   (ü ũ)
+		_float3		vPivot = {};				// ӵ  (vPivot ->  ġ)
+		_float2		vSpeed = { 1.f, 1.f };		// (min, max)
+		_float2		vLifeTime = { 1.f, 1.f };
+		_float2		vSize = { 1.f, 1.f };
+	};
+
+	// νϽ  ȿ   ϵ Ʈ ,  NO_ELEMENT
+	struct LAYOUT
+	{
+		static constexpr _uint NO_ELEMENT = ~0u;
+
+		_uint		iStride = {};
+		_uint		iPositionOffset = { NO_ELEMENT };	// _float4(w = 1)
+		_uint		iVelocityOffset = { NO_ELEMENT };	// _float4(xyz  * ӷ, w = ӷ)
+		_uint		iLifeTimeOffset = { NO_ELEMENT };	// _float2(ִ ,  0)
+		_uint		iSizeOffset = { NO_ELEMENT };		// _float
+	};
+
+private:
+	CParticle_Respawn() = default;
+	virtual ~CParticle_Respawn() = default;
+
+public:
+	// pIndices nullptr̸ [0, iCount) ü
+	// pLifeTimes   νϽ  (ִ, 0)  ε Բ 
+	static void				Respawn(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, const _uint* pIndices, _uint iCount, _uint iSeed, _float2* pLifeTimes = nullptr);
+
+	//  Ķ/õ/ Һ  (   ĳ)
+	shared_ptr<const vector<_byte>>	Find_InitialState(const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed);
+	// ü Ʈ :   ¸ Map ۷ (pLifeTimes   纻 ʱȭ)
+	HRESULT					Restart_All(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed, _float2* pLifeTimes = nullptr);
+	// Ȱȭ : CPU  纻   ( >= ִ) νϽ Respawn,  ִ νϽ ǵ帮 
+	// pMapped  , ٽ ¿ νϽ  pLifeTimes ݿ
+	// ȯ ٽ ¿ ( 纻    Ƿ 0)
+	_uint					Respawn_Dead(void* pMapped, const LAYOUT& tLayout, const INIT_DESC& tDesc, _float2* pLifeTimes, _uint iNumInstances, _uint iSeed);
+
+	_uint					Get_NumCachedStates() const { return (_uint)m_InitialStates.size(); }
+
+private:
+	static _uint64			Hash_Desc(const LAYOUT& tLayout, const INIT_DESC& tDesc, _uint iNumInstances, _uint iSeed);
+
+private:
+	unordered_map<_uint64, shared_ptr<const vector<_byte>>>	m_InitialStates;
+	vector<_uint>			m_DeadIndices;		// Respawn_Dead ۾( ȣ )
+
+public:
+	static CParticle_Respawn* Create();
+	virtual void			Free() override;
+};
+
+END
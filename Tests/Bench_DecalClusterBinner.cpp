@@ -0,0 +1,194 @@
+#include "Decal_ClusterBinner.h"
+#include "Test_Common.h"
+
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace Client;
+
+namespace
+{
+	constexpr uint32_t	SCREEN_WIDTH = 1920;
+	constexpr uint32_t	SCREEN_HEIGHT = 1080;
+	constexpr float		NEAR_Z = 0.1f;
+	constexpr float		FAR_Z = 500.f;
+
+	//  +Z  ī޶( =  ),   XMMatrixPerspectiveFovLH  ġ
+	void Make_Camera(float* pView, float* pProj)
+	{
+		for (int i = 0; i < 16; ++i)
+			pView[i] = (i % 5 == 0) ? 1.f : 0.f;
+
+		const float fFovY = 1.0471976f; // 60
+		const float fYScale = 1.f / tanf(fFovY * 0.5f);
+		const float fXScale = fYScale / (float(SCREEN_WIDTH) / float(SCREEN_HEIGHT));
+
+		for (int i = 0; i < 16; ++i)
+			pProj[i] = 0.f;
+		pProj[0] = fXScale;
+		pProj[5] = fYScale;
+		pProj[10] = FAR_Z / (FAR_Z - NEAR_Z);
+		pProj[11] = 1.f;
+		pProj[14] = -NEAR_Z * FAR_Z / (FAR_Z - NEAR_Z);
+	}
+
+	struct DECAL
+	{
+		float		World[16];
+		float		fSize;
+	};
+
+	vector<DECAL> Make_Decals(uint32_t iCount, uint32_t iSeed)
+	{
+		mt19937 Random(iSeed);
+		uniform_real_distribution<float> Depth(2.f, 200.f), Lateral(-0.9f, 0.9f), Size(0.3f, 3.f), Angle(0.f, 6.2831853f);
+
+		vector<DECAL> Decals(iCount);
+		for (auto& tDecal : Decals)
+		{
+			float fZ = Depth(Random);
+			float fYaw = Angle(Random);
+			float fCos = cosf(fYaw), fSin = sinf(fYaw);
+
+			// Y ȸ + þ  ġ
+			float World[16] = {
+				fCos, 0.f, -fSin, 0.f,
+				0.f, 1.f, 0.f, 0.f,
+				fSin, 0.f, fCos, 0.f,
+				Lateral(Random) * fZ * 0.9f, Lateral(Random) * fZ * 0.5f, fZ, 1.f };
+			memcpy(tDecal.World, World, sizeof(World));
+			tDecal.fSize = Size(Random);
+		}
+
+		return Decals;
+	}
+
+	//  Į ߽ Ǵ ȼ ŬͿ  Į  ־ 
+	void Test_CenterClusterContainsDecal()
+	{
+		float View[16], Proj[16];
+		Make_Camera(View, Proj);
+
+		CDecal_ClusterBinner Binner;
+		CDecal_ClusterBinner::DESC tDesc = {};
+		tDesc.iScreenWidth = SCREEN_WIDTH;
+		tDesc.iScreenHeight = SCREEN_HEIGHT;
+		tDesc.fNear = NEAR_Z;
+		tDesc.fFar = FAR_Z;
+		CHECK(Binner.Setup(tDesc));
+
+		auto Decals = Make_Decals(2000, 7);
+		for (uint32_t i = 0; i < (uint32_t)Decals.size(); ++i)
+			Binner.Add_Decal(i, Decals[i].World, Decals[i].fSize, Decals[i].fSize, Decals[i].fSize);
+
+		Binner.Bin(View, Proj);
+
+		auto tDims = Binner.Get_ClusterDims();
+		auto& Ranges = Binner.Get_ClusterRanges();
+		auto& Indices = Binner.Get_DecalIndices();
+
+		//  ε 迭 ƴ  
+		uint32_t iExpectedOffset = 0;
+		for (auto& tRange : Ranges)
+		{
+			CHECK(tRange.iOffset == iExpectedOffset);
+			iExpectedOffset += tRange.iCount;
+		}
+		CHECK(iExpectedOffset == (uint32_t)Indices.size());
+
+		for (uint32_t i = 0; i < (uint32_t)Decals.size(); ++i)
+		{
+			const float* pWorld = Decals[i].World;
+			float fX = pWorld[12], fY = pWorld[13], fZ = pWorld[14];
+
+			float fNdcX = fX * Proj[0] / fZ;
+			float fNdcY = fY * Proj[5] / fZ;
+			if (fabsf(fNdcX) >= 1.f || fabsf(fNdcY) >= 1.f)
+				continue;
+
+			uint32_t iTileX = min(uint32_t((fNdcX * 0.5f + 0.5f) * SCREEN_WIDTH) / tDims.w, tDims.x - 1);
+			uint32_t iTileY = min(uint32_t((0.5f - fNdcY * 0.5f) * SCREEN_HEIGHT) / tDims.w, tDims.y - 1);
+			uint32_t iSlice = Binner.Compute_Slice(fZ);
+
+			auto& tRange = Ranges[(iSlice * tDims.y + iTileY) * tDims.x + iTileX];
+			CHECK(find(Indices.begin() + tRange.iOffset, Indices.begin() + tRange.iOffset + tRange.iCount, i) != Indices.begin() + tRange.iOffset + tRange.iCount);
+		}
+	}
+
+	// ī޶ / ʸ Į  ŬͿ  
+	void Test_RejectOutsideDepth()
+	{
+		float View[16], Proj[16];
+		Make_Camera(View, Proj);
+
+		CDecal_ClusterBinner Binner;
+		CDecal_ClusterBinner::DESC tDesc = {};
+		tDesc.iScreenWidth = SCREEN_WIDTH;
+		tDesc.iScreenHeight = SCREEN_HEIGHT;
+		tDesc.fNear = NEAR_Z;
+		tDesc.fFar = FAR_Z;
+		CHECK(Binner.Setup(tDesc));
+
+		float Behind[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,-10,1 };
+		float Beyond[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,FAR_Z + 10.f,1 };
+		Binner.Add_Decal(0, Behind, 1.f, 1.f, 1.f);
+		Binner.Add_Decal(1, Beyond, 1.f, 1.f, 1.f);
+		Binner.Bin(View, Proj);
+
+		CHECK(Binner.Get_DecalIndices().empty());
+
+		CDecal_ClusterBinner::DESC tInvalid = tDesc;
+		tInvalid.fFar = tInvalid.fNear;
+		CHECK(!Binner.Setup(tInvalid));
+	}
+
+	// õ  Į  ð(1080p, 32px Ÿ, 16 ̽)
+	void Bench_Bin()
+	{
+		float View[16], Proj[16];
+		Make_Camera(View, Proj);
+
+		CDecal_ClusterBinner::DESC tDesc = {};
+		tDesc.iScreenWidth = SCREEN_WIDTH;
+		tDesc.iScreenHeight = SCREEN_HEIGHT;
+		tDesc.fNear = NEAR_Z;
+		tDesc.fFar = FAR_Z;
+
+		for (uint32_t iCount : { 1000u, 4000u, 16000u })
+		{
+			auto Decals = Make_Decals(iCount, iCount);
+
+			CDecal_ClusterBinner Binner;
+			Binner.Setup(tDesc);
+
+			const int iRepeat = 20;
+			double fMs = Measure_Ms([&]()
+				{
+					for (int r = 0; r < iRepeat; ++r)
+					{
+						Binner.Clear();
+						for (uint32_t i = 0; i < iCount; ++i)
+							Binner.Add_Decal(i, Decals[i].World, Decals[i].fSize, Decals[i].fSize, Decals[i].fSize);
+						Binner.Bin(View, Proj);
+					}
+				});
+
+			printf("[Bench] ClusterBinner %6u decals: %.3f ms / frame, %zu cluster entries\n",
+				iCount, fMs / iRepeat, Binner.Get_DecalIndices().size());
+		}
+	}
+}
+
+int main()
+{
+	Test_CenterClusterContainsDecal();
+	Test_RejectOutsideDepth();
+	Bench_Bin();
+
+	return TEST_RESULT();
+}
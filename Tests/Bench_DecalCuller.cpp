@@ -0,0 +1,132 @@
+#include "Decal_Culler.h"
+#include "Test_Common.h"
+
+#include <random>
+
+namespace
+{
+	constexpr _float	NEAR_Z = 0.1f;
+	constexpr _float	FAR_Z = 500.f;
+
+	//  +Z  ī޶( =  ) -, XMMatrixPerspectiveFovLH  ġ
+	_float4x4 Make_ViewProj()
+	{
+		const _float fYScale = 1.f / tanf(1.0471976f * 0.5f);
+
+		_float4x4 M = {};
+		M._11 = fYScale / (16.f / 9.f);
+		M._22 = fYScale;
+		M._33 = FAR_Z / (FAR_Z - NEAR_Z);
+		M._34 = 1.f;
+		M._43 = -NEAR_Z * FAR_Z / (FAR_Z - NEAR_Z);
+		return M;
+	}
+
+	_float4x4 Make_World(_float fYaw, const _float3& vPos)
+	{
+		_float4x4 M = {};
+		M._11 = cosf(fYaw);	M._13 = -sinf(fYaw);
+		M._22 = 1.f;
+		M._31 = sinf(fYaw);	M._33 = cosf(fYaw);
+		M._41 = vPos.x;	M._42 = vPos.y;	M._43 = vPos.z;	M._44 = 1.f;
+		return M;
+	}
+
+	// ī޶ ֺ 濡  ڽ(  ü/Ÿ )
+	void Fill(CDecal_Culler& Culler, _uint iNumBoxes, _uint iSeed)
+	{
+		mt19937 Random(iSeed);
+		uniform_real_distribution<_float> Position(-300.f, 300.f), Size(0.5f, 6.f), Angle(0.f, 6.2831853f);
+
+		Culler.Clear();
+		Culler.Reserve(iNumBoxes);
+		for (_uint i = 0; i < iNumBoxes; ++i)
+		{
+			_float fSize = Size(Random);
+			Culler.Add_Box(Make_World(Angle(Random), _float3(Position(Random), Position(Random) * 0.2f, Position(Random))), _float3(fSize, fSize * 0.5f, fSize));
+		}
+	}
+
+	void Test_Basic()
+	{
+		CDecal_Culler Culler;
+		Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, 10.f)), _float3(1.f, 1.f, 1.f));		// 
+		Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, -10.f)), _float3(1.f, 1.f, 1.f));	// 
+		Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, 120.f)), _float3(1.f, 1.f, 1.f));	// ִ Ÿ 
+		Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, -0.4f)), _float3(2.f, 2.f, 2.f));	//  ħ
+
+		Culler.Cull(Make_ViewProj(), _float3(0.f, 0.f, 0.f), 100.f);
+
+		auto& Visible = Culler.Get_Visible();
+		CHECK(Visible.size() == 2);
+		CHECK(Visible.size() == 2 && Visible[0] == 0 && Visible[1] == 3);
+	}
+
+	// Ÿ ø ڽ 豸 , 0   Ÿ ø (Į/AVX )
+	void Test_Distance()
+	{
+		for (_bool bUseSIMD : { false, true })
+		{
+			CDecal_Culler Culler;
+			Culler.Set_UseSIMD(bUseSIMD);
+
+			// 9 ̻̾ AVX θ Ž(8  + )
+			for (_uint i = 0; i < 9; ++i)
+			{
+				if (i == 0)
+					Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, 110.f)), _float3(30.f, 30.f, 30.f));	// ߽ , Ǵ 
+				else if (i == 1)
+					Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, 140.f)), _float3(30.f, 30.f, 30.f));	// 豸 
+				else
+					Culler.Add_Box(Make_World(0.f, _float3(0.f, 0.f, 10.f + i)), _float3(1.f, 1.f, 1.f));
+			}
+
+			Culler.Cull(Make_ViewProj(), _float3(0.f, 0.f, 0.f), 100.f);
+			auto Visible = Culler.Get_Visible();
+			CHECK(Visible.size() == 8);
+			CHECK(find(Visible.begin(), Visible.end(), 0u) != Visible.end());
+			CHECK(find(Visible.begin(), Visible.end(), 1u) == Visible.end());
+
+			//  : ü ̸ Ÿ 
+			for (_float fMaxDistance : { 0.f, -1.f })
+			{
+				Culler.Cull(Make_ViewProj(), _float3(0.f, 0.f, 0.f), fMaxDistance);
+				CHECK(Culler.Get_Visible().size() == 9);
+			}
+		}
+	}
+
+	// AVX ο Į   , 1  ڽ ø ð 
+	void Bench_Cull()
+	{
+		const _uint iNumBoxes = 10000;
+		const _int iRepeat = 200;
+		const _float4x4 ViewProj = Make_ViewProj();
+
+		CDecal_Culler Culler;
+		Fill(Culler, iNumBoxes + 3, 11);	// 8  ƴ    Ȯ
+
+		Culler.Set_UseSIMD(false);
+		double fScalarMs = Measure_Ms([&]() { for (_int r = 0; r < iRepeat; ++r) Culler.Cull(ViewProj, _float3(0.f, 0.f, 0.f), 250.f); });
+		vector<_uint> Scalar = Culler.Get_Visible();
+
+		Culler.Set_UseSIMD(true);
+		double fSimdMs = Measure_Ms([&]() { for (_int r = 0; r < iRepeat; ++r) Culler.Cull(ViewProj, _float3(0.f, 0.f, 0.f), 250.f); });
+
+		CHECK(Scalar == Culler.Get_Visible());
+		CHECK(!Scalar.empty() && Scalar.size() < iNumBoxes);
+
+		printf("[Bench] DecalCuller %u boxes, %zu visible: scalar %.4f ms, %s %.4f ms\n",
+			iNumBoxes + 3, Scalar.size(), fScalarMs / iRepeat,
+			CDecal_Culler::Is_AVXSupported() ? "AVX" : "scalar(no AVX)", fSimdMs / iRepeat);
+	}
+}
+
+int main()
+{
+	Test_Basic();
+	Test_Distance();
+	Bench_Cull();
+
+	return TEST_RESULT();
+}
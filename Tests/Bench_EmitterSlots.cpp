@@ -0,0 +1,264 @@
+#include "Emitter_Arena.h"
+#include "Test_Common.h"
+
+#include <new>
+
+// ׽Ʈ μ ü  뷮 (ε  ̷    )
+namespace
+{
+	size_t	g_iLiveBytes = 0;
+	size_t	g_iNumAllocs = 0;
+}
+
+void* operator new(size_t iSize)
+{
+	void* pMemory = malloc(iSize + 16);
+	if (!pMemory)
+		throw bad_alloc();
+
+	memcpy(pMemory, &iSize, sizeof(size_t));
+	g_iLiveBytes += iSize;
+	++g_iNumAllocs;
+
+	return static_cast<char*>(pMemory) + 16;
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	if (!pMemory)
+		return;
+
+	char* pBlock = static_cast<char*>(pMemory) - 16;
+	size_t iSize = 0;
+	memcpy(&iSize, pBlock, sizeof(size_t));
+	g_iLiveBytes -= iSize;
+
+	free(pBlock);
+}
+
+void* operator new[](size_t iSize) { return operator new(iSize); }
+void operator delete[](void* pMemory) noexcept { operator delete(pMemory); }
+void operator delete(void* pMemory, size_t) noexcept { operator delete(pMemory); }
+void operator delete[](void* pMemory, size_t) noexcept { operator delete(pMemory); }
+
+namespace
+{
+	// user-034  CEmitter::POOL_DESC / EFFECT_GROUP ġ
+	struct LEGACY_POOL_DESC
+	{
+		void*		pEffect = { nullptr };
+		_wstring	wsObjectTag;
+		_float		fInterval = {};
+		_float		fElapsed = {};
+		_bool		bOneShot = { false };
+	};
+
+	struct LEGACY_GROUP
+	{
+		vector<LEGACY_POOL_DESC>	Pools;
+		_bool						bGroupEnabled = false;
+	};
+
+	//  CEmitter::POOL_DESC / EFFECT_GROUP  ġ(Emitter.h   ̶   Ұ)
+	struct POOL_DESC
+	{
+		void*		pEffect = { nullptr };
+		_float		fInterval = {};
+		_float		fElapsed = {};
+		_float		fLifeTime = {};
+		_ushort		iTagIndex = { 0xFFFF };
+		_bool		bOneShot = { false };
+		_bool		bDecal = { false };
+	};
+	static_assert(sizeof(POOL_DESC) == 24 || sizeof(void*) != 8, "mirror of CEmitter::POOL_DESC");
+
+	struct EFFECT_GROUP
+	{
+		POOL_DESC*	pSlots = nullptr;
+		_uint		iNumSlots = 0;
+		_bool		bGroupEnabled = false;
+	};
+
+	struct COMPACT_EMITTER
+	{
+		CEmitter_Arena				Arena;
+		vector<_wstring>			ObjectTags;
+		map<_wstring, EFFECT_GROUP>	Groups;
+	};
+
+	// ռ : Ʈ (׷) , ׷  ,  ٸ Ÿ ±
+	struct SYNTHETIC_LEVEL
+	{
+		vector<_wstring>			GroupTags;
+		vector<vector<_uint>>		SlotTags;	// ׷캰  ± ȣ
+		vector<_wstring>			ObjectTags;
+	};
+
+	SYNTHETIC_LEVEL Make_Level(_uint iNumGroups, _uint iNumDistinctTags)
+	{
+		SYNTHETIC_LEVEL tLevel;
+
+		static const wchar_t* pKinds[] = { L"Particle_HitSpark", L"Particle_Blood", L"Effect_Slash", L"Effect_Decal_Blood", L"Effect_Trail_Sword", L"Particle_Dust" };
+		for (_uint i = 0; i < iNumDistinctTags; ++i)
+			tLevel.ObjectTags.push_back(_wstring(L"Prototype_GameObject_") + pKinds[i % 6] + L"_" + to_wstring(i));
+
+		_uint iState = 12345u;
+		for (_uint g = 0; g < iNumGroups; ++g)
+		{
+			tLevel.GroupTags.push_back(L"Effect_Group_" + to_wstring(g));
+
+			// xorshift ׷ 2~16
+			iState ^= iState << 13; iState ^= iState >> 17; iState ^= iState << 5;
+			_uint iNumSlots = 2 + iState % 15;
+
+			vector<_uint> Slots;
+			for (_uint s = 0; s < iNumSlots; ++s)
+			{
+				iState ^= iState << 13; iState ^= iState >> 17; iState ^= iState << 5;
+				Slots.push_back(iState % iNumDistinctTags);
+			}
+			tLevel.SlotTags.push_back(move(Slots));
+		}
+
+		return tLevel;
+	}
+
+	//  LoadEffects_FromFile: Ը ± ڿ  + ׷  push_back
+	void Load_Legacy(const SYNTHETIC_LEVEL& tLevel, map<_wstring, LEGACY_GROUP>& Groups)
+	{
+		for (size_t g = 0; g < tLevel.GroupTags.size(); ++g)
+		{
+			auto& group = Groups[tLevel.GroupTags[g]];
+			for (_uint iTag : tLevel.SlotTags[g])
+			{
+				LEGACY_POOL_DESC pd;
+				pd.wsObjectTag = tLevel.ObjectTags[iTag];
+				pd.fInterval = 1.f;
+				group.Pools.push_back(pd);
+			}
+		}
+	}
+
+	//  LoadEffects_FromFile: ±  + ӽ  -> Ʒ   
+	void Load_Compact(const SYNTHETIC_LEVEL& tLevel, COMPACT_EMITTER& Emitter)
+	{
+		vector<POOL_DESC> Slots;
+		for (size_t g = 0; g < tLevel.GroupTags.size(); ++g)
+		{
+			auto& group = Emitter.Groups[tLevel.GroupTags[g]];
+
+			Slots.clear();
+			for (_uint iTag : tLevel.SlotTags[g])
+			{
+				const _wstring& wsTag = tLevel.ObjectTags[iTag];
+				auto iter = find(Emitter.ObjectTags.begin(), Emitter.ObjectTags.end(), wsTag);
+				if (iter == Emitter.ObjectTags.end())
+					iter = Emitter.ObjectTags.insert(Emitter.ObjectTags.end(), wsTag);
+
+				POOL_DESC pd;
+				pd.iTagIndex = _ushort(iter - Emitter.ObjectTags.begin());
+				pd.fInterval = 1.f;
+				Slots.push_back(pd);
+			}
+
+			group.iNumSlots = (_uint)Slots.size();
+			group.pSlots = Emitter.Arena.Copy(Slots.data(), group.iNumSlots);
+		}
+	}
+
+	void Test_Arena()
+	{
+		CEmitter_Arena Arena;
+
+		void* pFirst = Arena.Allocate(3, 1);
+		void* pAligned = Arena.Allocate(8, 16);
+		CHECK(pFirst != nullptr);
+		CHECK(reinterpret_cast<uintptr_t>(pAligned) % 16 == 0);
+		CHECK(Arena.Get_NumBlocks() == 1);
+
+		// Ϻ ū û  
+		void* pLarge = Arena.Allocate(10000, 8);
+		CHECK(pLarge != nullptr);
+		CHECK(Arena.Get_NumBlocks() == 2);
+		CHECK(Arena.Get_BytesUsed() == 3 + 8 + 10000);
+
+		POOL_DESC Source[3] = {};
+		Source[1].iTagIndex = 7;
+		POOL_DESC* pCopy = Arena.Copy(Source, 3);
+		CHECK(pCopy && pCopy[1].iTagIndex == 7);
+		CHECK(Arena.Copy(Source, 0) == nullptr);
+
+		Arena.Release();
+		CHECK(Arena.Get_NumBlocks() == 0);
+		CHECK(Arena.Get_BytesReserved() == 0);
+	}
+
+	//  ռ   ġ εؼ   Ʈ/Ҵ Ƚ, ± ˻ ð 
+	void Bench_Level()
+	{
+		// ̹ ϳ Ʈ  60,  ٸ Ÿ 40  
+		const SYNTHETIC_LEVEL tLevel = Make_Level(60, 40);
+		_uint iNumSlots = 0;
+		for (auto& Slots : tLevel.SlotTags)
+			iNumSlots += (_uint)Slots.size();
+
+		size_t iLegacyBytes = 0, iLegacyAllocs = 0, iCompactBytes = 0, iCompactAllocs = 0;
+		double fLegacyMs = 0.0, fCompactMs = 0.0;
+		size_t iLegacyHits = 0, iCompactHits = 0;
+
+		{
+			size_t iBaseBytes = g_iLiveBytes, iBaseAllocs = g_iNumAllocs;
+			map<_wstring, LEGACY_GROUP> Groups;
+			Load_Legacy(tLevel, Groups);
+			iLegacyBytes = g_iLiveBytes - iBaseBytes;
+			iLegacyAllocs = g_iNumAllocs - iBaseAllocs;
+
+			// ActivateFromPool: ± ڿ 
+			fLegacyMs = Measure_Ms([&]()
+				{
+					for (_uint r = 0; r < 200; ++r)
+						for (auto& wsTag : tLevel.ObjectTags)
+							for (auto& [_, group] : Groups)
+								for (auto& pd : group.Pools)
+									iLegacyHits += (pd.wsObjectTag == wsTag);
+				});
+		}
+
+		{
+			size_t iBaseBytes = g_iLiveBytes, iBaseAllocs = g_iNumAllocs;
+			COMPACT_EMITTER Emitter;
+			Load_Compact(tLevel, Emitter);
+			iCompactBytes = g_iLiveBytes - iBaseBytes;
+			iCompactAllocs = g_iNumAllocs - iBaseAllocs;
+
+			// ActivateFromPool: ± ε   ã  
+			fCompactMs = Measure_Ms([&]()
+				{
+					for (_uint r = 0; r < 200; ++r)
+						for (auto& wsTag : tLevel.ObjectTags)
+						{
+							_ushort iTagIndex = _ushort(find(Emitter.ObjectTags.begin(), Emitter.ObjectTags.end(), wsTag) - Emitter.ObjectTags.begin());
+							for (auto& [_, group] : Emitter.Groups)
+								for (_uint s = 0; s < group.iNumSlots; ++s)
+									iCompactHits += (group.pSlots[s].iTagIndex == iTagIndex);
+						}
+				});
+		}
+
+		CHECK(iLegacyHits == iCompactHits);
+		CHECK(iCompactBytes < iLegacyBytes);
+		CHECK(iCompactAllocs < iLegacyAllocs);
+
+		printf("[Bench] Synthetic level: %zu groups, %u slots, %zu distinct tags\n", tLevel.GroupTags.size(), iNumSlots, tLevel.ObjectTags.size());
+		printf("[Bench]   legacy : slot %zu B, live heap %zu B in %zu allocations, tag lookup %.3f ms\n", sizeof(LEGACY_POOL_DESC), iLegacyBytes, iLegacyAllocs, fLegacyMs);
+		printf("[Bench]   compact: slot %zu B, live heap %zu B in %zu allocations, tag lookup %.3f ms\n", sizeof(POOL_DESC), iCompactBytes, iCompactAllocs, fCompactMs);
+	}
+}
+
+int main()
+{
+	Test_Arena();
+	Bench_Level();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Engine_Defines.h"
+
+BEGIN(Engine)
+
+// ׽Ʈ  CBase ü( īƮ + Free)
+class CBase abstract
+{
+protected:
+	CBase() = default;
+	virtual ~CBase() = default;
+
+public:
+	_uint AddRef() { return ++m_iRefCnt; }
+	_uint Release()
+	{
+		if (m_iRefCnt == 0)
+		{
+			Free();
+			delete this;
+			return 0;
+		}
+		return m_iRefCnt--;
+	}
+
+protected:
+	_uint m_iRefCnt = {};
+
+public:
+	virtual void Free() {}
+};
+
+template<typename T>
+void Safe_AddRef(T& pInstance)
+{
+	if (pInstance)
+		pInstance->AddRef();
+}
+
+template<typename T>
+_uint Safe_Release(T& pInstance)
+{
+	_uint iRefCnt = {};
+	if (pInstance)
+	{
+		iRefCnt = pInstance->Release();
+		if (iRefCnt == 0)
+			pInstance = nullptr;
+	}
+	return iRefCnt;
+}
+
+END
@@ -0,0 +1,2 @@
+#pragma once
+#include "Engine_Defines.h"
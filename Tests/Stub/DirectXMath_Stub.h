@@ -0,0 +1,111 @@
+#pragma once
+
+// ׽Ʈ  DirectXMath ּ ü(Į )
+//  ϴ CPU    Լ , Ծ DirectXMath ( , row-major)
+struct XMMATRIX
+{
+	_float m[4][4];
+};
+typedef const XMMATRIX _fmatrix;
+typedef const XMMATRIX& _cmatrix;
+typedef XMMATRIX _matrix;
+
+struct XMVECTOR
+{
+	_float f[4];
+};
+typedef const XMVECTOR _fvector;
+typedef XMVECTOR _vector;
+
+inline void XMStoreFloat4x4(_float4x4* pDst, _fmatrix M)
+{
+	memcpy(pDst->m, M.m, sizeof(M.m));
+}
+
+inline XMMATRIX XMLoadFloat4x4(const _float4x4* pSrc)
+{
+	XMMATRIX M;
+	memcpy(M.m, pSrc->m, sizeof(M.m));
+	return M;
+}
+
+inline XMMATRIX XMMatrixIdentity()
+{
+	XMMATRIX M = {};
+	for (int i = 0; i < 4; ++i)
+		M.m[i][i] = 1.f;
+	return M;
+}
+
+inline XMMATRIX XMMatrixTranslation(_float x, _float y, _float z)
+{
+	XMMATRIX M = XMMatrixIdentity();
+	M.m[3][0] = x;
+	M.m[3][1] = y;
+	M.m[3][2] = z;
+	return M;
+}
+
+inline XMMATRIX XMMatrixScaling(_float x, _float y, _float z)
+{
+	XMMATRIX M = XMMatrixIdentity();
+	M.m[0][0] = x;
+	M.m[1][1] = y;
+	M.m[2][2] = z;
+	return M;
+}
+
+inline XMMATRIX XMMatrixMultiply(_fmatrix A, _fmatrix B)
+{
+	XMMATRIX M = {};
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			for (int k = 0; k < 4; ++k)
+				M.m[r][c] += A.m[r][k] * B.m[k][c];
+	return M;
+}
+
+// 콺- Ұ(κ ǹ), Ư ̸ DirectXMathó Ѵ  0 
+inline XMMATRIX XMMatrixInverse(void* /*pDeterminant*/, _fmatrix M)
+{
+	_float a[4][8];
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+		{
+			a[r][c] = M.m[r][c];
+			a[r][c + 4] = (r == c) ? 1.f : 0.f;
+		}
+
+	for (int c = 0; c < 4; ++c)
+	{
+		int iPivot = c;
+		for (int r = c + 1; r < 4; ++r)
+			if (fabsf(a[r][c]) > fabsf(a[iPivot][c]))
+				iPivot = r;
+
+		if (a[iPivot][c] == 0.f)
+			return XMMATRIX{};
+
+		for (int k = 0; k < 8; ++k)
+			std::swap(a[c][k], a[iPivot][k]);
+
+		_float fInv = 1.f / a[c][c];
+		for (int k = 0; k < 8; ++k)
+			a[c][k] *= fInv;
+
+		for (int r = 0; r < 4; ++r)
+		{
+			if (r == c)
+				continue;
+			_float f = a[r][c];
+			for (int k = 0; k < 8; ++k)
+				a[r][k] -= f * a[c][k];
+		}
+	}
+
+	XMMATRIX Out;
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			Out.m[r][c] = a[r][c + 4];
+	return Out;
+}
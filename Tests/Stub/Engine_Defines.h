@@ -0,0 +1,105 @@
+#pragma once
+
+// ׽Ʈ    ü 
+// ̽  ʴ (Ҵ, , Į CPU )  ϱ  ּ Ÿ/ũ
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <fstream>
+
+// Ʈ JSON д (Į ۹̼ ),  ش ׽Ʈ Ÿ길 
+#if __has_include(<nlohmann/json.hpp>)
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+#endif
+
+#define BEGIN(NAMESPACE) namespace NAMESPACE {
+#define END }
+#define ENGINE_DLL
+#define abstract
+
+// MSVC  __super ü: ׽Ʈ  Ŭ ߰ Free  Ƿ CBase ٷ 
+#define __super CBase
+
+#define MSG_BOX(message) fprintf(stderr, "%s\n", message)
+
+typedef int32_t HRESULT;
+#define S_OK ((HRESULT)0)
+#define E_FAIL ((HRESULT)0x80004005)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+
+typedef bool				_bool;
+typedef char				_char;
+typedef signed char			_byte;
+typedef unsigned char		_ubyte;
+typedef unsigned short		_ushort;
+typedef int					_int;
+typedef unsigned int		_uint;
+typedef uint64_t			_uint64;
+typedef int64_t				_int64;
+typedef float				_float;
+typedef std::string			_string;
+typedef std::wstring		_wstring;
+
+struct _float2
+{
+	_float x, y;
+	_float2() = default;
+	constexpr _float2(_float _x, _float _y) : x(_x), y(_y) {}
+};
+
+struct _float3
+{
+	_float x, y, z;
+	_float3() = default;
+	constexpr _float3(_float _x, _float _y, _float _z) : x(_x), y(_y), z(_z) {}
+};
+
+struct _float4
+{
+	_float x, y, z, w;
+	_float4() = default;
+	constexpr _float4(_float _x, _float _y, _float _z, _float _w) : x(_x), y(_y), z(_z), w(_w) {}
+};
+
+struct _float4x4
+{
+	union
+	{
+		struct
+		{
+			_float _11, _12, _13, _14;
+			_float _21, _22, _23, _24;
+			_float _31, _32, _33, _34;
+			_float _41, _42, _43, _44;
+		};
+		_float m[4][4];
+	};
+};
+
+#include "DirectXMath_Stub.h"
+
+// D3D11 ü  ͷθ ̹Ƿ (̽ ڵ ׽Ʈ  )
+struct ID3D11Device;
+struct ID3D11DeviceContext;
+struct ID3D11Buffer;
+struct ID3D11ShaderResourceView;
+enum DXGI_FORMAT : int;
+
+namespace Engine {}
+namespace Client {}
+using namespace std;
+using namespace Engine;
+using namespace Client;
@@ -0,0 +1,28 @@
+#pragma once
+#include <chrono>
+
+// ׽Ʈ/ġũ  ּ ũ
+//    main  ڵ (ctest 0 ƴϸ  ó)
+inline int& Test_FailCount()
+{
+	static int iFailCount = 0;
+	return iFailCount;
+}
+
+#define CHECK(expr) \
+	do { if (!(expr)) { fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); ++Test_FailCount(); } } while (0)
+
+#define CHECK_NEAR(a, b, eps) \
+	do { double _da = (double)(a), _db = (double)(b); if (fabs(_da - _db) > (eps)) { fprintf(stderr, "%s:%d: CHECK_NEAR failed: %s = %g, %s = %g\n", __FILE__, __LINE__, #a, _da, #b, _db); ++Test_FailCount(); } } while (0)
+
+#define TEST_RESULT() (Test_FailCount() == 0 ? 0 : 1)
+
+// ġũ  ð(и)
+template<typename FUNC>
+double Measure_Ms(FUNC&& Func)
+{
+	auto tBegin = std::chrono::steady_clock::now();
+	Func();
+	auto tEnd = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(tEnd - tBegin).count();
+}
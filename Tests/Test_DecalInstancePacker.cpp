@@ -0,0 +1,181 @@
+#include "Decal_InstancePacker.h"
+#include "Test_Common.h"
+
+namespace
+{
+	using DECAL_INSTANCE = CDecal_InstancePacker::DECAL_INSTANCE;
+
+	//   fElapsedTime  ŷ   ã  ְ 
+	DECAL_INSTANCE Make_Instance(_uint iOrder)
+	{
+		DECAL_INSTANCE tInstance = {};
+		tInstance.vColor = _float4(_float(iOrder), 0.5f, 0.25f, 1.f);
+		tInstance.vBoxSize = _float4(1.f + iOrder, 2.f, 3.f, 0.f);
+		tInstance.fElapsedTime = _float(iOrder);
+		tInstance.fLifeTime = 10.f;
+		return tInstance;
+	}
+
+	_uint Order_Of(const DECAL_INSTANCE& tInstance)
+	{
+		return (_uint)tInstance.fElapsedTime;
+	}
+
+	//   i 
+	const _uint s_Materials[] = { 2, 0, 1, 0, 2, 2, 1, 0, 3, 1 };
+	constexpr _uint NUM_DECALS = sizeof(s_Materials) / sizeof(s_Materials[0]);
+
+	void Submit_All(CDecal_InstancePacker& Packer)
+	{
+		Packer.Clear();
+		for (_uint i = 0; i < NUM_DECALS; ++i)
+			Packer.Add(s_Materials[i], Make_Instance(i));
+	}
+
+	// 밪:  ,     ,  ʴ  
+	vector<_uint> Expected_Order(const vector<_bool>& Visible)
+	{
+		vector<_uint> Orders;
+		for (_uint iMaterial = 0; iMaterial < 4; ++iMaterial)
+		{
+			for (_uint i = 0; i < NUM_DECALS; ++i)
+			{
+				if (s_Materials[i] == iMaterial && Visible[i])
+					Orders.push_back(i);
+			}
+		}
+		return Orders;
+	}
+
+	void Check_Packed(const CDecal_InstancePacker& Packer, const vector<_bool>& Visible)
+	{
+		vector<_uint> Expected = Expected_Order(Visible);
+
+		auto& Instances = Packer.Get_Instances();
+		CHECK(Instances.size() == Expected.size());
+		if (Instances.size() != Expected.size())
+			return;
+
+		//  νϽ Ͱ   Ʈ  
+		for (size_t i = 0; i < Expected.size(); ++i)
+		{
+			CHECK(Order_Of(Instances[i]) == Expected[i]);
+
+			DECAL_INSTANCE tSubmitted = Make_Instance(Expected[i]);
+			CHECK(memcmp(&Instances[i], &tSubmitted, sizeof(DECAL_INSTANCE)) == 0);
+		}
+
+		// ġ:   ,   ġ 
+		_uint iNext = 0;
+		_uint iPrevMaterial = ~0u;
+		for (auto& tBatch : Packer.Get_Batches())
+		{
+			CHECK(tBatch.iStartInstance == iNext);
+			CHECK(tBatch.iNumInstances > 0);
+			CHECK(iPrevMaterial == ~0u || tBatch.iMaterialID > iPrevMaterial);
+
+			for (_uint i = 0; i < tBatch.iNumInstances; ++i)
+				CHECK(s_Materials[Order_Of(Instances[tBatch.iStartInstance + i])] == tBatch.iMaterialID);
+
+			iPrevMaterial = tBatch.iMaterialID;
+			iNext += tBatch.iNumInstances;
+		}
+		CHECK(iNext == (_uint)Instances.size());
+	}
+
+	void Test_NoCulling()
+	{
+		CDecal_InstancePacker Packer;
+		Submit_All(Packer);
+		Packer.Pack();
+
+		Check_Packed(Packer, vector<_bool>(NUM_DECALS, true));
+		CHECK(Packer.Get_Batches().size() == 4);
+	}
+
+	void Test_VisibleMask()
+	{
+		CDecal_InstancePacker Packer;
+		Submit_All(Packer);
+
+		//  3(8) øǾ ġ ü  
+		vector<_uint> VisibleIndices = { 9, 0, 3, 6, 7 };
+		Packer.Pack(&VisibleIndices, NUM_DECALS);
+
+		vector<_bool> Visible(NUM_DECALS, false);
+		for (_uint iIndex : VisibleIndices)
+			Visible[iIndex] = true;
+
+		Check_Packed(Packer, Visible);
+		CHECK(Packer.Get_Batches().size() == 3);
+	}
+
+	void Test_SubmittedAfterCull()
+	{
+		CDecal_InstancePacker Packer;
+		Submit_All(Packer);
+
+		//  6 ø , 6     ̴  
+		vector<_uint> VisibleIndices = { 1, 4 };
+		Packer.Pack(&VisibleIndices, 6);
+
+		vector<_bool> Visible(NUM_DECALS, false);
+		Visible[1] = Visible[4] = true;
+		for (_uint i = 6; i < NUM_DECALS; ++i)
+			Visible[i] = true;
+
+		Check_Packed(Packer, Visible);
+	}
+
+	void Test_AllCulled()
+	{
+		CDecal_InstancePacker Packer;
+		Submit_All(Packer);
+
+		//   ε 
+		vector<_uint> VisibleIndices = { NUM_DECALS, NUM_DECALS + 5 };
+		Packer.Pack(&VisibleIndices, NUM_DECALS);
+
+		CHECK(Packer.Get_Instances().empty());
+		CHECK(Packer.Get_Batches().empty());
+
+		// ٽ Packص  ״(ũ ٽ )
+		Packer.Pack();
+		Check_Packed(Packer, vector<_bool>(NUM_DECALS, true));
+	}
+
+	void Test_MatrixAdd()
+	{
+		CDecal_InstancePacker Packer;
+
+		_float4x4 World;
+		XMStoreFloat4x4(&World, XMMatrixMultiply(XMMatrixScaling(2.f, 4.f, 8.f), XMMatrixTranslation(1.f, 2.f, 3.f)));
+		Packer.Add(5, XMLoadFloat4x4(&World), _float3(1.f, 2.f, 3.f), _float4(1.f, 0.f, 0.f, 1.f), 0.5f, 2.f);
+		Packer.Pack();
+
+		CHECK(Packer.Get_Instances().size() == 1);
+		auto& tInstance = Packer.Get_Instances()[0];
+
+		// : ̵ (1, 2, 3) ,  
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[0][0], 0.5f, 1e-6);
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[1][1], 0.25f, 1e-6);
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[2][2], 0.125f, 1e-6);
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[3][0], -0.5f, 1e-6);
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[3][1], -0.5f, 1e-6);
+		CHECK_NEAR(tInstance.WorldMatrixInv.m[3][2], -0.375f, 1e-6);
+		CHECK(tInstance.vBoxSize.w == 0.f && tInstance.vBoxSize.z == 3.f);
+		CHECK(tInstance.fElapsedTime == 0.5f && tInstance.fLifeTime == 2.f);
+		CHECK(Packer.Get_Batches().size() == 1 && Packer.Get_Batches()[0].iMaterialID == 5);
+	}
+}
+
+int main()
+{
+	Test_NoCulling();
+	Test_VisibleMask();
+	Test_SubmittedAfterCull();
+	Test_AllCulled();
+	Test_MatrixAdd();
+
+	return TEST_RESULT();
+}
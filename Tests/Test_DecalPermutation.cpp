@@ -0,0 +1,226 @@
+#include "Decal_Permutation.h"
+#include "Test_Common.h"
+
+#include <filesystem>
+
+namespace
+{
+	// ũ  ״  ִ  Ϸ
+	class CCompiler_Stub final : public CDecal_Permutation::CCompiler
+	{
+	private:
+		explicit CCompiler_Stub(_uint64 iOptionsHash) : m_iOptionsHash(iOptionsHash) {}
+		virtual ~CCompiler_Stub() = default;
+
+	public:
+		virtual HRESULT Compile(const _wstring& /*wsShaderPath*/, const vector<CDecal_Permutation::MACRO>& Macros, vector<_byte>* pBlob) override
+		{
+			++m_iNumCompiles;
+
+			_string strBlob;
+			for (auto& tMacro : Macros)
+				strBlob += tMacro.strName + "=" + tMacro.strDefinition + ";";
+
+			pBlob->assign(strBlob.begin(), strBlob.end());
+			return S_OK;
+		}
+
+		virtual _uint64 Get_OptionsHash() const override { return m_iOptionsHash; }
+
+		_uint Get_NumCompiles() const { return m_iNumCompiles; }
+
+	private:
+		_uint64		m_iOptionsHash = {};
+		_uint		m_iNumCompiles = {};
+
+	public:
+		static CCompiler_Stub* Create(_uint64 iOptionsHash) { return new CCompiler_Stub(iOptionsHash); }
+	};
+
+	struct TEST_FILES
+	{
+		filesystem::path	Directory;
+		_wstring			wsShader;
+		_wstring			wsInclude;
+		_wstring			wsCache;
+	};
+
+	void Write_Text(const _wstring& wsPath, const _string& strText)
+	{
+		ofstream ofs(filesystem::path(wsPath), ios::binary | ios::trunc);
+		ofs << strText;
+	}
+
+	TEST_FILES Make_Files()
+	{
+		TEST_FILES tFiles;
+		tFiles.Directory = filesystem::temp_directory_path() / "Test_DecalPermutation";
+		filesystem::remove_all(tFiles.Directory);
+		filesystem::create_directories(tFiles.Directory);
+
+		tFiles.wsShader = (tFiles.Directory / "Shader_Effect_Decal.hlsl").wstring();
+		tFiles.wsInclude = (tFiles.Directory / "Engine_Shader_Defines.hlsli").wstring();
+		tFiles.wsCache = (tFiles.Directory / "Decal.cache").wstring();
+
+		Write_Text(tFiles.wsShader, "#include \"Engine_Shader_Defines.hlsli\"\nfloat4 g_vColor;\n");
+		Write_Text(tFiles.wsInclude, "sampler LinearSampler;\n");
+
+		return tFiles;
+	}
+
+	json Make_Effect()
+	{
+		return json::parse(R"({
+			"GameObjects": [
+				{ "szPrototypeTag": "Prototype_GameObject_Effect_Decal", "bUseMaskTexture": true, "bUseColor": true },
+				{ "szPrototypeTag": "Prototype_GameObject_Effect_Decal", "bUseMaskTexture": true, "bUseColor": true },
+				{ "szPrototypeTag": "Prototype_GameObject_Effect_Decal", "bUseAtlas_Diffuse": true },
+				{ "szPrototypeTag": "Prototype_GameObject_Effect_Particle", "bUseColor": true }
+			]
+		})");
+	}
+
+	CDecal_Permutation* Make_Built(const TEST_FILES& tFiles, CCompiler_Stub* pCompiler)
+	{
+		CDecal_Permutation* pPermutation = CDecal_Permutation::Create();
+		pPermutation->Collect_FromJson(Make_Effect());
+		CHECK(SUCCEEDED(pPermutation->Build_Cache(pCompiler, tFiles.wsShader, tFiles.wsCache)));
+		return pPermutation;
+	}
+
+	// Į Ʈ  ٸ ո Ŵ佺Ʈ 
+	void Test_Manifest()
+	{
+		CDecal_Permutation* pPermutation = CDecal_Permutation::Create();
+		pPermutation->Collect_FromJson(Make_Effect());
+
+		auto& Manifest = pPermutation->Get_Manifest();
+		CHECK(Manifest.size() == 2);
+		CHECK(Manifest.count(CDecal_Permutation::FEATURE_MASK | CDecal_Permutation::FEATURE_COLOR) == 1);
+		CHECK(Manifest.count(CDecal_Permutation::FEATURE_ATLAS_DIFFUSE) == 1);
+
+		CHECK(CDecal_Permutation::Make_CacheKey(0x13, 0x0123456789ABCDEFull) == "DECAL_13_0123456789ABCDEF");
+
+		Safe_Release(pPermutation);
+	}
+
+	//  ĳø  νϽ    ãƾ 
+	void Test_RoundTrip()
+	{
+		auto tFiles = Make_Files();
+		auto* pCompiler = CCompiler_Stub::Create(7);
+		auto* pBuilt = Make_Built(tFiles, pCompiler);
+		CHECK(pCompiler->Get_NumCompiles() == 2);
+
+		CDecal_Permutation* pLoaded = CDecal_Permutation::Create();
+		CHECK(SUCCEEDED(pLoaded->Load_Cache(pCompiler, tFiles.wsShader, tFiles.wsCache)));
+
+		for (_uint iFlags : pBuilt->Get_Manifest())
+		{
+			auto* pExpected = pBuilt->Find_Blob(iFlags);
+			auto* pActual = pLoaded->Find_Blob(iFlags);
+			CHECK(pExpected && pActual && *pExpected == *pActual);
+		}
+		CHECK(pLoaded->Find_Blob(CDecal_Permutation::FEATURE_UV_ANIMATION) == nullptr);
+
+		Safe_Release(pLoaded);
+		Safe_Release(pBuilt);
+		Safe_Release(pCompiler);
+	}
+
+	// include ̳   ٲ ĳø  
+	void Test_Invalidation()
+	{
+		auto tFiles = Make_Files();
+		auto* pCompiler = CCompiler_Stub::Create(7);
+		auto* pOtherOptions = CCompiler_Stub::Create(8);
+		auto* pBuilt = Make_Built(tFiles, pCompiler);
+
+		CDecal_Permutation* pLoaded = CDecal_Permutation::Create();
+		CHECK(FAILED(pLoaded->Load_Cache(pOtherOptions, tFiles.wsShader, tFiles.wsCache)));
+
+		Write_Text(tFiles.wsInclude, "sampler LinearSampler;\nsampler PointSampler;\n");
+		CHECK(FAILED(pLoaded->Load_Cache(pCompiler, tFiles.wsShader, tFiles.wsCache)));
+		CHECK(pLoaded->Find_Blob(CDecal_Permutation::FEATURE_ATLAS_DIFFUSE) == nullptr);
+
+		Safe_Release(pLoaded);
+		Safe_Release(pBuilt);
+		Safe_Release(pOtherOptions);
+		Safe_Release(pCompiler);
+	}
+
+	// ջ ĳ(߸, ͹Ͼ )   
+	void Test_CorruptCache()
+	{
+		auto tFiles = Make_Files();
+		auto* pCompiler = CCompiler_Stub::Create(7);
+		auto* pBuilt = Make_Built(tFiles, pCompiler);
+
+		vector<char> Original;
+		{
+			ifstream ifs(filesystem::path(tFiles.wsCache), ios::binary);
+			Original.assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+		}
+
+		auto Try_Load = [&](const vector<char>& Bytes)
+		{
+			{
+				ofstream ofs(filesystem::path(tFiles.wsCache), ios::binary | ios::trunc);
+				ofs.write(Bytes.data(), Bytes.size());
+			}
+
+			CDecal_Permutation* pLoaded = CDecal_Permutation::Create();
+			HRESULT hr = E_FAIL;
+			try
+			{
+				hr = pLoaded->Load_Cache(pCompiler, tFiles.wsShader, tFiles.wsCache);
+			}
+			catch (...)
+			{
+				CHECK(!"Load_Cache threw");
+			}
+			Safe_Release(pLoaded);
+			return hr;
+		};
+
+		const size_t iHeaderSize = sizeof(_uint) * 3 + sizeof(_uint64);
+
+		// ߸ 
+		for (size_t iSize : { size_t(0), size_t(6), iHeaderSize, Original.size() - 1 })
+			CHECK(FAILED(Try_Load(vector<char>(Original.begin(), Original.begin() + iSize))));
+
+		// ׸ 
+		vector<char> Bytes = Original;
+		_uint iHuge = 0xFFFFFFFFu;
+		memcpy(Bytes.data() + iHeaderSize - sizeof(_uint), &iHuge, sizeof(_uint));
+		CHECK(FAILED(Try_Load(Bytes)));
+
+		// ù ׸ Ű 
+		Bytes = Original;
+		memcpy(Bytes.data() + iHeaderSize, &iHuge, sizeof(_uint));
+		CHECK(FAILED(Try_Load(Bytes)));
+
+		// ù ׸  ũ
+		_uint iKeyLength = 0;
+		memcpy(&iKeyLength, Original.data() + iHeaderSize, sizeof(_uint));
+		Bytes = Original;
+		memcpy(Bytes.data() + iHeaderSize + sizeof(_uint) + iKeyLength, &iHuge, sizeof(_uint));
+		CHECK(FAILED(Try_Load(Bytes)));
+
+		CHECK(SUCCEEDED(Try_Load(Original)));
+
+		Safe_Release(pBuilt);
+		Safe_Release(pCompiler);
+		filesystem::remove_all(tFiles.Directory);
+	}
+}
+
+int main()
+{
+	Test_Manifest();
+	Test_RoundTrip();
+	Test_Invalidation();
+	Test_CorruptCache();
+
+	return TEST_RESULT();
+}
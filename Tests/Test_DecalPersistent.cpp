@@ -0,0 +1,187 @@
+#include "Decal_Persistent.h"
+#include "Decal_Batch.h"
+#include "Test_Common.h"
+
+// ġ  ̽ ̶  ʰ,  Į x ǥ 
+static vector<_float> g_Submitted;
+
+void CDecal_Batch::Submit(_uint, _fmatrix WorldMatrix, const _float3&, const _float4&, _float, _float)
+{
+	g_Submitted.push_back(WorldMatrix.m[3][0]);
+}
+
+namespace
+{
+	struct FIXTURE
+	{
+		CDecal_Persistent* pDecals = nullptr;
+
+		explicit FIXTURE(_uint iCapacity)
+		{
+			CDecal_Persistent::DESC tDesc;
+			tDesc.iCapacity = iCapacity;
+			tDesc.fCellSize = 1.f;
+			tDesc.fMergeRatio = 0.7f;
+			tDesc.fRejectAge = 0.25f;
+			pDecals = CDecal_Persistent::Create(tDesc);
+		}
+
+		~FIXTURE() { Safe_Release(pDecals); }
+
+		CDecal_Persistent::ADD_RESULT Add(_float fX, _uint iMaterialID = 0, _float fLifeTime = 100.f, _float fAlpha = 1.f)
+		{
+			return pDecals->Add(iMaterialID, XMMatrixTranslation(fX, 0.f, 0.f), _float3(1.f, 1.f, 1.f), _float4(1.f, 1.f, 1.f, fAlpha), fLifeTime);
+		}
+
+		// ִ Į x ǥ Submit ( ͺ)
+		vector<_float> Order() const
+		{
+			g_Submitted.clear();
+			pDecals->Submit(reinterpret_cast<CDecal_Batch*>(&g_Submitted));	// ׽Ʈ 뿪 this  
+
+			return g_Submitted;
+		}
+
+		// Կ ִ Į x ǥ(׾ -1)
+		_float Slot_X(_uint iSlot) const
+		{
+			auto& tDecal = pDecals->Get_Decal(iSlot);
+			return tDecal.bAlive ? tDecal.WorldMatrix._41 : -1.f;
+		}
+	};
+
+	//  á      ͺ ü
+	void Test_EvictionOrder()
+	{
+		FIXTURE tFixture(4);
+
+		for (_float fX : { 0.f, 10.f, 20.f, 30.f })
+			CHECK(tFixture.Add(fX) == CDecal_Persistent::ADD_INSERTED);
+
+		CHECK(tFixture.pDecals->Get_NumAlive() == 4);
+		CHECK(tFixture.Order() == vector<_float>({ 0.f, 10.f, 20.f, 30.f }));
+
+		CHECK(tFixture.Add(40.f) == CDecal_Persistent::ADD_INSERTED);
+		CHECK(tFixture.Add(50.f) == CDecal_Persistent::ADD_INSERTED);
+
+		// 0, 10 ִ  0, 1 ʷ 
+		CHECK(tFixture.Slot_X(0) == 40.f);
+		CHECK(tFixture.Slot_X(1) == 50.f);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 4);
+		CHECK(tFixture.Order() == vector<_float>({ 20.f, 30.f, 40.f, 50.f }));
+	}
+
+	//     ִ   Į  
+	void Test_DeadSlotFirst()
+	{
+		FIXTURE tFixture(4);
+
+		tFixture.Add(0.f);
+		tFixture.Add(10.f, 0, 1.f);		//  1 ª 
+		tFixture.Add(20.f);
+		tFixture.Add(30.f);
+
+		tFixture.pDecals->Update(1.5f);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 3);
+		CHECK(tFixture.Slot_X(1) == -1.f);
+
+		CHECK(tFixture.Add(40.f) == CDecal_Persistent::ADD_INSERTED);
+		CHECK(tFixture.Slot_X(1) == 40.f);
+		CHECK(tFixture.Slot_X(0) == 0.f);	//   Į ״
+		CHECK(tFixture.pDecals->Get_NumAlive() == 4);
+		CHECK(tFixture.Order() == vector<_float>({ 0.f, 20.f, 30.f, 40.f }));
+	}
+
+	//    ġ     Į (ʹ  ), յ Į ü   ڷ
+	void Test_Merge()
+	{
+		FIXTURE tFixture(3);
+
+		tFixture.Add(0.f, 0, 5.f, 0.5f);
+		tFixture.Add(10.f);
+
+		//  (fRejectAge ̸) ź
+		CHECK(tFixture.Add(0.1f) == CDecal_Persistent::ADD_REJECTED);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 2);
+
+		tFixture.pDecals->Update(0.5f);
+
+		CHECK(tFixture.Add(0.1f, 0, 8.f, 0.9f) == CDecal_Persistent::ADD_MERGED);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 2);
+
+		auto& tMerged = tFixture.pDecals->Get_Decal(0);
+		CHECK(tMerged.fAge == 0.f);
+		CHECK(tMerged.fLifeTime == 8.f);		//   
+		CHECK(tMerged.vColor.w == 0.9f);		//   
+		CHECK(tMerged.WorldMatrix._41 == 0.f);	// ġ  ״
+		CHECK(tFixture.Order() == vector<_float>({ 10.f, 0.f }));
+
+		// ٸ , ħ  ̴  
+		CHECK(tFixture.Add(0.f, 1) == CDecal_Persistent::ADD_INSERTED);
+		tFixture.pDecals->Update(0.5f);
+		CHECK(tFixture.Add(0.6f) == CDecal_Persistent::ADD_INSERTED);
+
+		//   ¿  Į:  ڷ и 0  10  ü
+		FIXTURE tFull(2);
+		tFull.Add(0.f);
+		tFull.Add(10.f);
+		tFull.pDecals->Update(0.5f);
+		CHECK(tFull.Add(0.f) == CDecal_Persistent::ADD_MERGED);
+		CHECK(tFull.Add(20.f) == CDecal_Persistent::ADD_INSERTED);
+		CHECK(tFull.Order() == vector<_float>({ 0.f, 20.f }));
+	}
+
+	//  ǥ ؽ Ű  Ѵ ġ(NaN ) źϰ ¸ ٲ 
+	void Test_OutOfRange()
+	{
+		FIXTURE tFixture(4);
+
+		CHECK(tFixture.Add(0.f) == CDecal_Persistent::ADD_INSERTED);
+
+		CHECK(tFixture.Add(2.e6f) == CDecal_Persistent::ADD_REJECTED);
+		CHECK(tFixture.Add(-2.e6f) == CDecal_Persistent::ADD_REJECTED);
+		CHECK(tFixture.Add(nanf("")) == CDecal_Persistent::ADD_REJECTED);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 1);
+		CHECK(tFixture.Order() == vector<_float>({ 0.f }));
+
+		//    ġ  
+		CHECK(tFixture.Add(1.e5f) == CDecal_Persistent::ADD_INSERTED);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 2);
+	}
+
+	//   ̰ ̵ (fAge / fLifeTime) 
+	void Test_FadeOutAll()
+	{
+		FIXTURE tFixture(4);
+
+		tFixture.Add(0.f, 0, 10.f);
+		tFixture.Add(10.f, 0, 5.5f);
+		tFixture.pDecals->Update(5.f);
+
+		tFixture.pDecals->Fade_Out_All(1.f);
+
+		auto& tLong = tFixture.pDecals->Get_Decal(0);
+		CHECK_NEAR(tLong.fLifeTime - tLong.fAge, 1.f, 1e-5);
+		CHECK_NEAR(tLong.fAge / tLong.fLifeTime, 0.5f, 1e-5);
+
+		// ̹ fDuration ª  Į ״
+		auto& tShort = tFixture.pDecals->Get_Decal(1);
+		CHECK(tShort.fLifeTime == 5.5f);
+		CHECK(tShort.fAge == 5.f);
+
+		tFixture.pDecals->Update(1.01f);
+		CHECK(tFixture.pDecals->Get_NumAlive() == 0);
+		CHECK(tFixture.Order().empty());
+	}
+}
+
+int main()
+{
+	Test_EvictionOrder();
+	Test_DeadSlotFirst();
+	Test_Merge();
+	Test_OutOfRange();
+	Test_FadeOutAll();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,151 @@
+#include "Decal_Reconstruct.h"
+#include "Test_Common.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+	_float4x4 Make_Identity()
+	{
+		_float4x4 M = {};
+		M._11 = M._22 = M._33 = M._44 = 1.f;
+		return M;
+	}
+
+	// XMMatrixPerspectiveFovLH  ġ
+	_float4x4 Make_Proj(_float fFovY, _float fAspect, _float fNear, _float fFar)
+	{
+		_float fYScale = 1.f / tanf(fFovY * 0.5f);
+
+		_float4x4 M = {};
+		M._11 = fYScale / fAspect;
+		M._22 = fYScale;
+		M._33 = fFar / (fFar - fNear);
+		M._34 = 1.f;
+		M._43 = -fNear * fFar / (fFar - fNear);
+		return M;
+	}
+
+	// ī޶ vEye Y fYawŭ  ִ  (  )
+	_float4x4 Make_View(const _float3& vEye, _float fYaw)
+	{
+		_float fCos = cosf(fYaw), fSin = sinf(fYaw);
+
+		_float4x4 M = Make_Identity();
+		M._11 = fCos;	M._13 = fSin;
+		M._31 = -fSin;	M._33 = fCos;
+		M._41 = -(vEye.x * fCos - vEye.z * fSin);
+		M._42 = -vEye.y;
+		M._43 = -(vEye.x * fSin + vEye.z * fCos);
+		return M;
+	}
+
+	//  -> Z ȸ -> ̵
+	_float4x4 Make_World(const _float3& vScale, _float fRoll, const _float3& vPos)
+	{
+		_float fCos = cosf(fRoll), fSin = sinf(fRoll);
+
+		_float4x4 M = {};
+		M._11 = vScale.x * fCos;	M._12 = vScale.x * fSin;
+		M._21 = -vScale.y * fSin;	M._22 = vScale.y * fCos;
+		M._33 = vScale.z;
+		M._41 = vPos.x;	M._42 = vPos.y;	M._43 = vPos.z;	M._44 = 1.f;
+		return M;
+	}
+
+	CDecal_Reconstruct::CAMERA_DESC Make_Camera(_float fYaw)
+	{
+		CDecal_Reconstruct::CAMERA_DESC tCamera = {};
+		tCamera.ViewMatrix = Make_View(_float3(1.f, 2.f, -3.f), fYaw);
+		tCamera.ProjMatrix = Make_Proj(1.0471976f, 16.f / 9.f, 0.1f, 300.f);
+		tCamera.fFar = 300.f;
+		return tCamera;
+	}
+
+	//   ȼ      ο ġؾ 
+	void Test_ViewRayMatchesMatrices()
+	{
+		for (_float fYaw : { 0.f, 0.35f, -0.6f })
+		{
+			auto tCamera = Make_Camera(fYaw);
+
+			// ī޶  񽺵 ڽ, ȼ   ̴ ڽ //  
+			_float4x4 World = Make_World(_float3(4.f, 2.f, 3.f), 0.4f, _float3(1.f + 12.f * sinf(fYaw), 1.5f, -3.f + 12.f * cosf(fYaw)));
+			auto tResult = CDecal_Reconstruct::Compare(tCamera, World, 96, { 2.f, 9.f, 12.f, 15.f, 60.f });
+
+			printf("[ViewRay] yaw %+.2f: %u samples, max %.2e, avg %.2e\n", fYaw, tResult.iNumSamples, tResult.fMaxError, tResult.fAvgError);
+
+			CHECK(tResult.iNumSamples > 1000);
+			CHECK(tResult.fMaxError < 1e-3f);
+		}
+	}
+
+	//   ڽ: ߸ ﰢ(Ͷ  Ŭ  Ŭ)  ΰ ġؾ 
+	void Test_NearPlaneClippedBox()
+	{
+		auto tCamera = Make_Camera(0.f);
+
+		// ī޶(1, 2, -3) δ  ڽ,   𼭸 
+		_float4x4 World = Make_World(_float3(3.f, 3.f, 10.f), 0.f, _float3(1.f, 2.f, 0.f));
+		auto tResult = CDecal_Reconstruct::Compare(tCamera, World, 64, { 1.f, 4.f });
+
+		printf("[NearPlane] %u triangles (%u clipped), %u samples, max %.2e\n", tResult.iNumTriangles, tResult.iNumClipped, tResult.iNumSamples, tResult.fMaxError);
+
+		CHECK(tResult.iNumClipped > 0);
+		CHECK(tResult.iNumSamples > 0);
+		CHECK(tResult.fMaxError < 1e-3f);
+	}
+
+	// ڽ    ķ Ű  ȼ  ̸     ; (fFar  Ÿ y )
+	void Test_LocalReconstruct()
+	{
+		auto tCamera = Make_Camera(0.2f);
+
+		//  2, Z ȸ 1rad, ̵ (0, 1, 8)  
+		_float4x4 World = Make_World(_float3(2.f, 2.f, 2.f), 1.f, _float3(0.f, 1.f, 8.f));
+		_float4x4 WorldInv = Make_Identity();
+		{
+			_float fCos = cosf(1.f), fSin = sinf(1.f);
+			WorldInv._11 = fCos * 0.5f;		WorldInv._12 = -fSin * 0.5f;
+			WorldInv._21 = fSin * 0.5f;		WorldInv._22 = fCos * 0.5f;
+			WorldInv._33 = 0.5f;
+			WorldInv._41 = -(World._41 * WorldInv._11 + World._42 * WorldInv._21);
+			WorldInv._42 = -(World._41 * WorldInv._12 + World._42 * WorldInv._22);
+			WorldInv._43 = -World._43 * 0.5f;
+		}
+
+		const _float4x4& V = tCamera.ViewMatrix;
+		const _float4x4& P = tCamera.ProjMatrix;
+
+		for (const _float3& vLocal : { _float3(0.f, 0.f, 0.f), _float3(0.4f, -0.3f, 0.2f), _float3(-0.5f, 0.5f, -0.5f) })
+		{
+			//  -> (ڽ ȯ) ->  -> ȭ
+			_float fWorldX = vLocal.x * World._11 + vLocal.y * World._21 + vLocal.z * World._31 + World._41;
+			_float fWorldY = vLocal.x * World._12 + vLocal.y * World._22 + vLocal.z * World._32 + World._42;
+			_float fWorldZ = vLocal.x * World._13 + vLocal.y * World._23 + vLocal.z * World._33 + World._43;
+
+			_float fViewX = fWorldX * V._11 + fWorldY * V._21 + fWorldZ * V._31 + V._41;
+			_float fViewY = fWorldX * V._12 + fWorldY * V._22 + fWorldZ * V._32 + V._42;
+			_float fViewZ = fWorldX * V._13 + fWorldY * V._23 + fWorldZ * V._33 + V._43;
+
+			_float2 vUV = _float2((fViewX * P._11 / fViewZ) * 0.5f + 0.5f, (fViewY * P._22 / fViewZ) * -0.5f + 0.5f);
+			_float2 vDepth = _float2(CDecal_Reconstruct::Depth_FromViewZ(tCamera, fViewZ), fViewZ / tCamera.fFar);
+
+			_float3 vResult = CDecal_Reconstruct::Local_FromMatrices(tCamera, WorldInv, vUV, vDepth);
+
+			CHECK_NEAR(vResult.x, vLocal.x, 1e-4);
+			CHECK_NEAR(vResult.y, vLocal.y, 1e-4);
+			CHECK_NEAR(vResult.z, vLocal.z, 1e-4);
+		}
+	}
+}
+
+int main()
+{
+	Test_ViewRayMatchesMatrices();
+	Test_NearPlaneClippedBox();
+	Test_LocalReconstruct();
+
+	return TEST_RESULT();
+}
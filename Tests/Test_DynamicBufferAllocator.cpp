@@ -0,0 +1,154 @@
+#include "DynamicBufferAllocator.h"
+#include "Test_Common.h"
+
+namespace
+{
+	constexpr _uint NUM_REGIONS = 3;
+	constexpr _uint REGION_SIZE = 256;
+
+	struct FIXTURE
+	{
+		CDynamicBufferBackend_Null*	pBackend = CDynamicBufferBackend_Null::Create(REGION_SIZE * NUM_REGIONS);
+		CDynamicBufferAllocator*	pAllocator = CDynamicBufferAllocator::Create(pBackend, NUM_REGIONS);
+
+		~FIXTURE()
+		{
+			Safe_Release(pAllocator);
+			Safe_Release(pBackend);
+		}
+
+		CDynamicBufferAllocator::ALLOCATION Map(_uint iBytes = REGION_SIZE)
+		{
+			CDynamicBufferAllocator::ALLOCATION tAlloc = {};
+			CHECK(SUCCEEDED(pAllocator->Map_Region(iBytes, &tAlloc)));
+			pAllocator->Unmap_Region(iBytes);
+			return tAlloc;
+		}
+	};
+
+	// Ӵ Map 1ȸ:  0 ƿ  DISCARD,  NO_OVERWRITE
+	void Test_OneMapPerFrame()
+	{
+		FIXTURE tFixture;
+
+		for (_uint iFrame = 0; iFrame < 12; ++iFrame)
+		{
+			auto tAlloc = tFixture.Map();
+			CHECK(tAlloc.iRegion == iFrame % NUM_REGIONS);
+			CHECK(tAlloc.iByteOffset == tAlloc.iRegion * REGION_SIZE);
+			CHECK(tAlloc.bDiscard == (tAlloc.iRegion == 0));
+
+			tFixture.pAllocator->Begin_Frame();
+		}
+
+		CHECK(tFixture.pBackend->Get_NumDiscards() == 12 / NUM_REGIONS);
+		CHECK(tFixture.pBackend->Get_NumMaps() == 12);
+		CHECK(tFixture.pAllocator->Get_TotalWrapCount() == 12 / NUM_REGIONS);
+	}
+
+	// Ӵ Map Ƚ ޶(Clear + Update,   ׸) NO_OVERWRITE  DISCARD     
+	// GPU     Ƿ   ( GPU   )   
+	void Test_VariableMapsPerFrame()
+	{
+		FIXTURE tFixture;
+
+		const _uint MapsPerFrame[] = { 1, 2, 0, 4, 3, 1, 5, 2, 2, 1 };
+
+		_bool Written[NUM_REGIONS] = {};
+		_bool bHasBuffer = false;
+		_uint iNumNoOverwrite = {};
+
+		for (_uint iNumMaps : MapsPerFrame)
+		{
+			for (_uint iMap = 0; iMap < iNumMaps; ++iMap)
+			{
+				auto tAlloc = tFixture.Map();
+
+				if (tAlloc.bDiscard)
+				{
+					fill(begin(Written), end(Written), false);
+					bHasBuffer = true;
+				}
+
+				else
+				{
+					CHECK(bHasBuffer);
+					CHECK(!Written[tAlloc.iRegion]);
+					++iNumNoOverwrite;
+				}
+
+				Written[tAlloc.iRegion] = true;
+			}
+
+			tFixture.pAllocator->Begin_Frame();
+		}
+
+		CHECK(iNumNoOverwrite > 0);
+		CHECK(tFixture.pBackend->Get_NumDiscards() + iNumNoOverwrite == tFixture.pBackend->Get_NumMaps());
+	}
+
+	// Begin_Frame   Map( ӿ   ׸ ):  ȣ ϰ  ȯ Ģ
+	void Test_NoFrameAdvance()
+	{
+		FIXTURE tFixture;
+
+		for (_uint i = 0; i < 8; ++i)
+		{
+			auto tAlloc = tFixture.Map();
+			CHECK(tAlloc.bDiscard == (i % NUM_REGIONS == 0));
+		}
+
+		CHECK(tFixture.pAllocator->Get_FrameIndex() == 0);
+	}
+
+	// NO_OVERWRITE          ,    DISCARD   
+	void Test_NoOverwriteKeepsOtherRegions()
+	{
+		FIXTURE tFixture;
+
+		for (_uint iFrame = 0; iFrame < NUM_REGIONS - 1; ++iFrame)
+		{
+			CDynamicBufferAllocator::ALLOCATION tAlloc = {};
+			CHECK(SUCCEEDED(tFixture.pAllocator->Map_Region(REGION_SIZE, &tAlloc)));
+			memset(tAlloc.pData, (int)(iFrame + 1), REGION_SIZE);
+			tFixture.pAllocator->Unmap_Region(REGION_SIZE);
+			tFixture.pAllocator->Begin_Frame();
+		}
+
+		auto tAlloc = tFixture.Map();
+		CHECK(tAlloc.iRegion == NUM_REGIONS - 1 && !tAlloc.bDiscard);
+		CHECK(tFixture.pBackend->Get_Memory()[0] == 1);
+		CHECK(tFixture.pBackend->Get_Memory()[REGION_SIZE] == 2);
+
+		//  0  DISCARD(Null 鿣   0xCD )
+		tAlloc = tFixture.Map();
+		CHECK(tAlloc.iRegion == 0 && tAlloc.bDiscard);
+		CHECK(tFixture.pBackend->Get_Memory()[REGION_SIZE] == (_byte)0xCD);
+	}
+
+	void Test_Errors()
+	{
+		FIXTURE tFixture;
+
+		CDynamicBufferAllocator::ALLOCATION tAlloc = {};
+		CHECK(FAILED(tFixture.pAllocator->Map_Region(REGION_SIZE + 1, &tAlloc)));
+
+		CHECK(SUCCEEDED(tFixture.pAllocator->Map_Region(16, &tAlloc)));
+		CHECK(FAILED(tFixture.pAllocator->Map_Region(16, &tAlloc)));	// ø Map
+		tFixture.pAllocator->Unmap_Region(16);
+
+		CHECK(tFixture.pAllocator->Get_FrameStats().iBytesUploaded == 16);
+		CHECK(!tFixture.pBackend->Is_Mapped());
+	}
+}
+
+int main()
+{
+	Test_OneMapPerFrame();
+	Test_VariableMapsPerFrame();
+	Test_NoFrameAdvance();
+	Test_NoOverwriteKeepsOtherRegions();
+	Test_Errors();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,74 @@
+#include "Emitter_Timer.h"
+#include "Test_Common.h"
+
+namespace
+{
+	// CEmitter::Update  бó   
+	_uint Run_Virtual(_float& fElapsed, _float fInterval, _float fLifeTime, _float fDuration, _float fTimeDelta = 1.f / 60.f)
+	{
+		_uint iNumFired = 0;
+		_uint iNumFrames = _uint(fDuration / fTimeDelta + 0.5f);
+		for (_uint i = 0; i < iNumFrames; ++i)
+			iNumFired += CEmitter_Timer::Advance_Virtual(fElapsed, fInterval, fLifeTime, fTimeDelta);
+		return iNumFired;
+	}
+
+	//   ٰ̾ :  ߻  ٽ  
+	void Test_ResumeAfterLifeTime()
+	{
+		// ֱ 2,  0.5, 5.3  -> 2 ߻,  ߻  1.3( )
+		_float fElapsed = 0.f;
+		CHECK(Run_Virtual(fElapsed, 2.f, 0.5f, 5.3f) == 2);
+		CHECK_NEAR(fElapsed, 1.3f, 1e-3);
+		CHECK(!CEmitter_Timer::Is_AliveOnResume(fElapsed, 0.5f));
+
+		//  1.5ʸ  ߻    ->   
+		fElapsed = 0.f;
+		CHECK(Run_Virtual(fElapsed, 2.f, 1.5f, 4.4f) == 2);
+		CHECK_NEAR(fElapsed, 0.4f, 1e-3);
+		CHECK(CEmitter_Timer::Is_AliveOnResume(fElapsed, 1.5f));
+
+		//   ū Ÿ(ε  )  ֱ 
+		fElapsed = 0.5f;
+		CHECK(CEmitter_Timer::Advance_Virtual(fElapsed, 2.f, 0.5f, 1000.f) == 500);
+		CHECK(fElapsed >= 0.f && fElapsed < 2.f);
+		CHECK_NEAR(fElapsed, 0.5f, 1e-3);
+	}
+
+	// ֱⰡ    ֱ  fElapsed  ȿ ӹ
+	void Test_NoInterval()
+	{
+		_float fElapsed = 0.f;
+		CHECK(Run_Virtual(fElapsed, 0.f, 1.f, 10.25f) == 10);
+		CHECK(fElapsed >= 0.f && fElapsed < 1.f);
+		CHECK(CEmitter_Timer::Is_AliveOnResume(fElapsed, 1.f));
+
+		fElapsed = 0.f;
+		for (_uint i = 0; i < 100; ++i)
+			CEmitter_Timer::Advance_Virtual(fElapsed, -1.f, 3.f, 100.f);
+		CHECK(fElapsed >= 0.f && fElapsed < 3.f);
+
+		//     
+		fElapsed = 5.f;
+		CHECK(CEmitter_Timer::Advance_Virtual(fElapsed, 0.f, 0.f, 1.f) == 0);
+		CHECK(fElapsed == 0.f);
+		CHECK(!CEmitter_Timer::Is_AliveOnResume(fElapsed, 0.f));
+	}
+
+	// ߻   
+	void Test_BeforeFirstFire()
+	{
+		_float fElapsed = 0.f;
+		CHECK(Run_Virtual(fElapsed, 2.f, 1.f, 0.5f) == 0);
+		CHECK_NEAR(fElapsed, 0.5f, 1e-3);
+	}
+}
+
+int main()
+{
+	Test_ResumeAfterLifeTime();
+	Test_NoInterval();
+	Test_BeforeFirstFire();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,199 @@
+#include "Particle_Respawn.h"
+#include "Test_Common.h"
+
+namespace
+{
+	// CVIBuffer_Point_Instancing νϽ   ġ(ȸ  Ŀ ǵ帮  )
+	struct INSTANCE
+	{
+		_float4		vRight;
+		_float4		vPosition;
+		_float4		vVelocity;
+		_float2		vLifeTime;
+		_float		fSize;
+		_float		fPadding;
+	};
+
+	CParticle_Respawn::LAYOUT Make_Layout()
+	{
+		CParticle_Respawn::LAYOUT tLayout;
+		tLayout.iStride = sizeof(INSTANCE);
+		tLayout.iPositionOffset = offsetof(INSTANCE, vPosition);
+		tLayout.iVelocityOffset = offsetof(INSTANCE, vVelocity);
+		tLayout.iLifeTimeOffset = offsetof(INSTANCE, vLifeTime);
+		tLayout.iSizeOffset = offsetof(INSTANCE, fSize);
+		return tLayout;
+	}
+
+	CParticle_Respawn::INIT_DESC Make_Desc()
+	{
+		CParticle_Respawn::INIT_DESC tDesc;
+		tDesc.vCenter = _float3(1.f, 2.f, 3.f);
+		tDesc.vRange = _float3(2.f, 4.f, 6.f);
+		tDesc.vPivot = _float3(1.f, 0.f, 3.f);
+		tDesc.vSpeed = _float2(2.f, 5.f);
+		tDesc.vLifeTime = _float2(0.5f, 1.5f);
+		tDesc.vSize = _float2(0.1f, 0.3f);
+		return tDesc;
+	}
+
+	vector<INSTANCE> Make_Instances(_uint iCount)
+	{
+		vector<INSTANCE> Instances(iCount);
+		for (auto& tInstance : Instances)
+			tInstance.vRight = _float4(7.f, 7.f, 7.f, 7.f);
+		return Instances;
+	}
+
+	//  ° INIT_DESC  
+	void Check_Spawned(const INSTANCE& tInstance, const CParticle_Respawn::INIT_DESC& tDesc)
+	{
+		CHECK(fabsf(tInstance.vPosition.x - tDesc.vCenter.x) <= tDesc.vRange.x * 0.5f);
+		CHECK(fabsf(tInstance.vPosition.y - tDesc.vCenter.y) <= tDesc.vRange.y * 0.5f);
+		CHECK(fabsf(tInstance.vPosition.z - tDesc.vCenter.z) <= tDesc.vRange.z * 0.5f);
+		CHECK(tInstance.vPosition.w == 1.f);
+
+		_float fSpeed = tInstance.vVelocity.w;
+		CHECK(fSpeed >= tDesc.vSpeed.x && fSpeed <= tDesc.vSpeed.y);
+		_float fLength = sqrtf(tInstance.vVelocity.x * tInstance.vVelocity.x + tInstance.vVelocity.y * tInstance.vVelocity.y + tInstance.vVelocity.z * tInstance.vVelocity.z);
+		CHECK_NEAR(fLength, fSpeed, 1e-3);
+
+		CHECK(tInstance.vLifeTime.x >= tDesc.vLifeTime.x && tInstance.vLifeTime.x <= tDesc.vLifeTime.y);
+		CHECK(tInstance.vLifeTime.y == 0.f);
+		CHECK(tInstance.fSize >= tDesc.vSize.x && tInstance.fSize <= tDesc.vSize.y);
+
+		CHECK(tInstance.vRight.x == 7.f && tInstance.vRight.w == 7.f);
+	}
+
+	//  õ =  , ٸ õ = ٸ , (4  ƴ)  
+	void Test_Deterministic()
+	{
+		auto tLayout = Make_Layout();
+		auto tDesc = Make_Desc();
+
+		auto First = Make_Instances(37), Second = Make_Instances(37), Other = Make_Instances(37);
+		CParticle_Respawn::Respawn(First.data(), tLayout, tDesc, nullptr, 37, 3);
+		CParticle_Respawn::Respawn(Second.data(), tLayout, tDesc, nullptr, 37, 3);
+		CParticle_Respawn::Respawn(Other.data(), tLayout, tDesc, nullptr, 37, 4);
+
+		CHECK(memcmp(First.data(), Second.data(), sizeof(INSTANCE) * 37) == 0);
+		CHECK(memcmp(First.data(), Other.data(), sizeof(INSTANCE) * 37) != 0);
+
+		for (auto& tInstance : First)
+			Check_Spawned(tInstance, tDesc);
+	}
+
+	// Ȱȭ CPU  纻   νϽ ٽ ¿  ִ  ״
+	void Test_RespawnDead()
+	{
+		auto tLayout = Make_Layout();
+		auto tDesc = Make_Desc();
+		auto* pRespawn = CParticle_Respawn::Create();
+
+		auto Instances = Make_Instances(16);
+		vector<_float2> LifeTimes(16);
+		CParticle_Respawn::Respawn(Instances.data(), tLayout, tDesc, nullptr, 16, 1, LifeTimes.data());
+
+		for (_uint i = 0; i < 16; ++i)
+			CHECK(memcmp(&LifeTimes[i], &Instances[i].vLifeTime, sizeof(_float2)) == 0);
+
+		// Ȧ νϽ  , ¦  (纻 , ۴ GPU Ѵٰ )
+		for (_uint i = 0; i < 16; ++i)
+			LifeTimes[i].y = (i % 2) ? LifeTimes[i].x : LifeTimes[i].x * 0.5f;
+
+		auto Before = Instances;
+		_uint iNumRespawned = pRespawn->Respawn_Dead(Instances.data(), tLayout, tDesc, LifeTimes.data(), 16, 2);
+		CHECK(iNumRespawned == 8);
+
+		for (_uint i = 0; i < 16; ++i)
+		{
+			if (i % 2)
+			{
+				Check_Spawned(Instances[i], tDesc);
+				CHECK(memcmp(&LifeTimes[i], &Instances[i].vLifeTime, sizeof(_float2)) == 0);
+			}
+			else
+			{
+				CHECK(memcmp(&Instances[i], &Before[i], sizeof(INSTANCE)) == 0);
+			}
+		}
+
+		//    ƹ͵  
+		Before = Instances;
+		CHECK(pRespawn->Respawn_Dead(Instances.data(), tLayout, tDesc, LifeTimes.data(), 16, 3) == 0);
+		CHECK(memcmp(Instances.data(), Before.data(), sizeof(INSTANCE) * 16) == 0);
+
+		//  纻   Ұ
+		CHECK(pRespawn->Respawn_Dead(Instances.data(), tLayout, tDesc, nullptr, 16, 3) == 0);
+
+		Safe_Release(pRespawn);
+	}
+
+	// Map   ϰ 纻θ ϰ,  ִ νϽ Ʈ  ״
+	void Test_RespawnDead_WriteOnly()
+	{
+		auto tLayout = Make_Layout();
+		auto tDesc = Make_Desc();
+		auto* pRespawn = CParticle_Respawn::Create();
+
+		//     ""ó ̴  , 纻 3 
+		auto Instances = Make_Instances(8);
+		memset(Instances.data(), 0xCD, sizeof(INSTANCE) * 8);
+		for (auto& tInstance : Instances)
+			tInstance.vLifeTime = _float2(0.f, 1.f);
+
+		vector<_float2> LifeTimes(8, _float2(1.f, 0.25f));
+		LifeTimes[3].y = 1.f;
+
+		auto Before = Instances;
+		CHECK(pRespawn->Respawn_Dead(Instances.data(), tLayout, tDesc, LifeTimes.data(), 8, 7) == 1);
+
+		for (_uint i = 0; i < 8; ++i)
+		{
+			if (i == 3)
+				continue;
+
+			CHECK(memcmp(&Instances[i], &Before[i], sizeof(INSTANCE)) == 0);
+			CHECK(LifeTimes[i].x == 1.f && LifeTimes[i].y == 0.25f);
+		}
+
+		// ٽ ¿ νϽ   (ȸ , е) ״
+		CHECK(memcmp(&Instances[3].vRight, &Before[3].vRight, sizeof(_float4)) == 0);
+		CHECK(memcmp(&Instances[3].fPadding, &Before[3].fPadding, sizeof(_float)) == 0);
+		CHECK(LifeTimes[3].y == 0.f && LifeTimes[3].x == Instances[3].vLifeTime.x);
+
+		Safe_Release(pRespawn);
+	}
+
+	// ü  ĳõ   ̸ Respawn ü  
+	void Test_RestartAll()
+	{
+		auto tLayout = Make_Layout();
+		auto tDesc = Make_Desc();
+		auto* pRespawn = CParticle_Respawn::Create();
+
+		auto Expected = Make_Instances(20), Restarted = Make_Instances(20);
+		CParticle_Respawn::Respawn(Expected.data(), tLayout, tDesc, nullptr, 20, 5);
+
+		CHECK(SUCCEEDED(pRespawn->Restart_All(Restarted.data(), tLayout, tDesc, 20, 5)));
+		vector<_float2> LifeTimes(20);
+		CHECK(SUCCEEDED(pRespawn->Restart_All(Restarted.data(), tLayout, tDesc, 20, 5, LifeTimes.data())));
+		CHECK(pRespawn->Get_NumCachedStates() == 1);
+		CHECK(memcmp(Expected.data(), Restarted.data(), sizeof(INSTANCE) * 20) == 0);
+
+		for (_uint i = 0; i < 20; ++i)
+			CHECK(memcmp(&LifeTimes[i], &Expected[i].vLifeTime, sizeof(_float2)) == 0);
+
+		Safe_Release(pRespawn);
+	}
+}
+
+int main()
+{
+	Test_Deterministic();
+	Test_RespawnDead();
+	Test_RespawnDead_WriteOnly();
+	Test_RestartAll();
+
+	return TEST_RESULT();
+}
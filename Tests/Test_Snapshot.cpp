@@ -0,0 +1,467 @@
+#include "Trail_Snapshot.h"
+#include "Emitter_Snapshot.h"
+#include "Test_Common.h"
+
+namespace
+{
+	// ---------------------------------------------------------------- Ʈ(CTrail_Snapshot)
+
+	CTrail_Snapshot::STATE Make_Trail(_uint iNumSamples, _uint iSeed)
+	{
+		CTrail_Snapshot::STATE tState;
+		tState.tParams.iMaxTrailPoints = 64;
+		tState.tParams.iCatmullCount = 8;
+		tState.tParams.fSampleRate = 60.f;
+		tState.tParams.fTessellationRate = 30.f;
+		tState.fTime = 12.5f + iSeed;
+
+		for (_uint i = 0; i < iNumSamples; ++i)
+		{
+			_float f = _float(i + iSeed);
+			tState.Samples.push_back({ { f, f * 0.5f, -f }, { f, f * 0.5f + 1.f, -f }, tState.fTime - (iNumSamples - 1 - i) / 60.f });
+		}
+
+		return tState;
+	}
+
+	_bool Is_Equal(const CTrail_Snapshot::STATE& A, const CTrail_Snapshot::STATE& B)
+	{
+		if (A.tParams.iMaxTrailPoints != B.tParams.iMaxTrailPoints || A.tParams.iCatmullCount != B.tParams.iCatmullCount ||
+			A.tParams.fSampleRate != B.tParams.fSampleRate || A.tParams.fTessellationRate != B.tParams.fTessellationRate ||
+			A.fTime != B.fTime || A.Samples.size() != B.Samples.size())
+			return false;
+
+		// ̷ε  ״ ǹǷ Ʈ  ƾ 
+		return A.Samples.empty() || memcmp(A.Samples.data(), B.Samples.data(), A.Samples.size() * sizeof(CTrail_Snapshot::SAMPLE)) == 0;
+	}
+
+	void Test_RoundTrip()
+	{
+		auto tSaved = Make_Trail(40, 3);
+
+		vector<_byte> Bytes;
+		CTrail_Snapshot::Save(tSaved, Bytes);
+		CHECK(Bytes.size() == sizeof(SNAPSHOT_HEADER) + 5 * 4 + 4 + 40 * sizeof(CTrail_Snapshot::SAMPLE));
+
+		CTrail_Snapshot::STATE tLoaded;
+		CHECK(SUCCEEDED(CTrail_Snapshot::Load(Bytes.data(), Bytes.size(), tLoaded)));
+		CHECK(Is_Equal(tSaved, tLoaded));
+
+		//  Ʈ
+		auto tEmpty = Make_Trail(0, 0);
+		Bytes.clear();
+		CTrail_Snapshot::Save(tEmpty, Bytes);
+		CHECK(SUCCEEDED(CTrail_Snapshot::Load(Bytes.data(), Bytes.size(), tLoaded)));
+		CHECK(Is_Equal(tEmpty, tLoaded));
+	}
+
+	void Test_Concatenated()
+	{
+		//  ۿ   ̾   ̷ε ũ 踦 ã
+		auto tFirst = Make_Trail(5, 1), tSecond = Make_Trail(9, 2);
+
+		vector<_byte> Bytes;
+		CTrail_Snapshot::Save(tFirst, Bytes);
+		size_t iFirstSize = Bytes.size();
+		CTrail_Snapshot::Save(tSecond, Bytes);
+
+		CTrail_Snapshot::STATE tLoaded;
+		CHECK(SUCCEEDED(CTrail_Snapshot::Load(Bytes.data(), iFirstSize, tLoaded)));
+		CHECK(Is_Equal(tFirst, tLoaded));
+		CHECK(SUCCEEDED(CTrail_Snapshot::Load(Bytes.data() + iFirstSize, Bytes.size() - iFirstSize, tLoaded)));
+		CHECK(Is_Equal(tSecond, tLoaded));
+	}
+
+	//  1( ð, ֱ, ð ): ֱ/ð   ,  ð  ֱ  ο
+	void Test_Version1()
+	{
+		vector<_byte> Bytes;
+		{
+			CSnapshot_Writer Writer(Bytes);
+			Writer.Begin(CTrail_Snapshot::MAGIC, 1);
+			Writer.Write((_int)16);
+			Writer.Write((_int)4);
+			Writer.Write((_uint)3);
+			for (_uint i = 0; i < 3; ++i)
+			{
+				Writer.Write(_float3(_float(i), 0.f, 0.f));
+				Writer.Write(_float3(_float(i), 1.f, 0.f));
+			}
+			Writer.End();
+		}
+
+		CTrail_Snapshot::STATE tState = Make_Trail(2, 7);
+		tState.tParams.fSampleRate = 30.f;
+		tState.tParams.fTessellationRate = 15.f;
+		tState.fTime = 2.f;
+
+		CHECK(SUCCEEDED(CTrail_Snapshot::Load(Bytes.data(), Bytes.size(), tState)));
+		CHECK(tState.tParams.iMaxTrailPoints == 16);
+		CHECK(tState.tParams.iCatmullCount == 4);
+		CHECK(tState.tParams.fSampleRate == 30.f);
+		CHECK(tState.tParams.fTessellationRate == 15.f);
+		CHECK(tState.fTime == 2.f);
+		CHECK(tState.Samples.size() == 3);
+
+		for (_uint i = 0; i < tState.Samples.size(); ++i)
+		{
+			CHECK(tState.Samples[i].vLow.x == _float(i) && tState.Samples[i].vHigh.y == 1.f);
+			CHECK_NEAR(tState.Samples[i].fTime, 2.f - (2 - i) / 30.f, 1e-6);
+		}
+
+		//  1 ߸ ,  
+		const auto tBefore = tState;
+		CHECK(FAILED(CTrail_Snapshot::Load(Bytes.data(), Bytes.size() - 1, tState)));
+		CHECK(Is_Equal(tBefore, tState));
+	}
+
+	void Test_Truncated()
+	{
+		auto tSaved = Make_Trail(12, 4);
+
+		vector<_byte> Bytes;
+		CTrail_Snapshot::Save(tSaved, Bytes);
+
+		//  ̿ ߷ ϰ  ´ ״
+		auto tCurrent = Make_Trail(3, 9);
+		const auto tBefore = tCurrent;
+
+		_uint iNumAccepted = 0;
+		for (size_t iSize = 0; iSize < Bytes.size(); ++iSize)
+		{
+			if (SUCCEEDED(CTrail_Snapshot::Load(Bytes.data(), iSize, tCurrent)))
+				++iNumAccepted;
+		}
+
+		CHECK(iNumAccepted == 0);
+		CHECK(Is_Equal(tBefore, tCurrent));
+
+		//  ϰ ̷ε常 ߸ ( ũ   ״, ۸ ª)
+		vector<_byte> Truncated(Bytes.begin(), Bytes.end() - sizeof(CTrail_Snapshot::SAMPLE) / 2);
+		CHECK(FAILED(CTrail_Snapshot::Load(Truncated.data(), Truncated.size(), tCurrent)));
+		CHECK(Is_Equal(tBefore, tCurrent));
+	}
+
+	void Test_Corrupt()
+	{
+		auto tSaved = Make_Trail(6, 5);
+
+		vector<_byte> Bytes;
+		CTrail_Snapshot::Save(tSaved, Bytes);
+
+		CTrail_Snapshot::STATE tLoaded;
+
+		// ٸ 
+		vector<_byte> BadMagic = Bytes;
+		BadMagic[0] ^= 0x5A;
+		CHECK(FAILED(CTrail_Snapshot::Load(BadMagic.data(), BadMagic.size(), tLoaded)));
+
+		// ϴ ͺ  
+		vector<_byte> NewerVersion = Bytes;
+		_ushort iVersion = CTrail_Snapshot::VERSION + 1;
+		memcpy(NewerVersion.data() + offsetof(SNAPSHOT_HEADER, iVersion), &iVersion, sizeof(_ushort));
+		CHECK(FAILED(CTrail_Snapshot::Load(NewerVersion.data(), NewerVersion.size(), tLoaded)));
+
+		// ̷ε ũⰡ  ͺ ŭ
+		vector<_byte> BadPayload = Bytes;
+		_uint iPayloadBytes = 0xFFFFFFF0u;
+		memcpy(BadPayload.data() + offsetof(SNAPSHOT_HEADER, iPayloadBytes), &iPayloadBytes, sizeof(_uint));
+		CHECK(FAILED(CTrail_Snapshot::Load(BadPayload.data(), BadPayload.size(), tLoaded)));
+
+		//   ִġ 
+		vector<_byte> BadCount = Bytes;
+		_uint iNumSamples = 1000;
+		memcpy(BadCount.data() + sizeof(SNAPSHOT_HEADER) + 5 * 4, &iNumSamples, sizeof(_uint));
+		CHECK(FAILED(CTrail_Snapshot::Load(BadCount.data(), BadCount.size(), tLoaded)));
+
+		// ̷ε ũ⸦ ̸   дٰ (  ͸  )
+		vector<_byte> ShortPayload = Bytes;
+		_uint iShortBytes = _uint(Bytes.size() - sizeof(SNAPSHOT_HEADER) - 1);
+		memcpy(ShortPayload.data() + offsetof(SNAPSHOT_HEADER, iPayloadBytes), &iShortBytes, sizeof(_uint));
+		CHECK(FAILED(CTrail_Snapshot::Load(ShortPayload.data(), ShortPayload.size(), tLoaded)));
+	}
+
+	// ---------------------------------------------------------------- ̹(CEmitter_Snapshot)
+
+	// CEmitter::POOL_DESC / EFFECT_GROUP   (Emitter.h  Ʈ ̶   Ұ)
+	struct SLOT
+	{
+		void*		pEffect = { nullptr };
+		_float		fInterval = {};
+		_float		fElapsed = {};
+		_bool		bOneShot = { false };
+	};
+
+	struct GROUP
+	{
+		SLOT*		pSlots = nullptr;
+		_uint		iNumSlots = 0;
+		_bool		bGroupEnabled = false;
+	};
+
+	struct EMITTER
+	{
+		map<_wstring, GROUP>	Groups;
+		vector<vector<SLOT>>	Storage;
+		_uint					iRandomState = {};
+
+		void Add_Group(const _wstring& wsTag, _uint iNumSlots, _float fBase)
+		{
+			vector<SLOT> Slots(iNumSlots);
+			for (_uint i = 0; i < iNumSlots; ++i)
+				Slots[i] = { nullptr, fBase + i, fBase * 0.5f + i, (i % 2) == 0 };
+
+			Storage.push_back(move(Slots));
+			Groups[wsTag] = { Storage.back().data(), iNumSlots, fBase > 1.f };
+		}
+	};
+
+	EMITTER Make_Emitter(_float fBase, _uint iRandomState)
+	{
+		EMITTER tEmitter;
+		tEmitter.Storage.reserve(8);
+		tEmitter.Add_Group(L"Blood", 3, fBase);
+		tEmitter.Add_Group(L"Spark", 2, fBase + 10.f);
+		tEmitter.Add_Group(L"Smoke", 4, fBase + 20.f);
+		tEmitter.iRandomState = iRandomState;
+		return tEmitter;
+	}
+
+	_bool Is_Equal(const EMITTER& A, const EMITTER& B)
+	{
+		if (A.iRandomState != B.iRandomState || A.Groups.size() != B.Groups.size())
+			return false;
+
+		for (auto& [wsTag, group] : A.Groups)
+		{
+			auto iter = B.Groups.find(wsTag);
+			if (iter == B.Groups.end() || iter->second.iNumSlots != group.iNumSlots || iter->second.bGroupEnabled != group.bGroupEnabled)
+				return false;
+
+			for (_uint i = 0; i < group.iNumSlots; ++i)
+			{
+				auto& tA = group.pSlots[i];
+				auto& tB = iter->second.pSlots[i];
+				if (tA.fInterval != tB.fInterval || tA.fElapsed != tB.fElapsed || tA.bOneShot != tB.bOneShot)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Test_Emitter_RoundTrip()
+	{
+		EMITTER tSaved = Make_Emitter(2.f, 0x12345678u);
+
+		vector<_byte> Bytes;
+		CEmitter_Snapshot::Save(tSaved.Groups, tSaved.iRandomState, Bytes);
+
+		EMITTER tLoaded = Make_Emitter(0.f, 1u);
+		CHECK(!Is_Equal(tSaved, tLoaded));
+		CHECK(SUCCEEDED(CEmitter_Snapshot::Load(Bytes.data(), Bytes.size(), tLoaded.Groups, tLoaded.iRandomState)));
+		CHECK(Is_Equal(tSaved, tLoaded));
+
+		//  ׷,   ٸ ׷ ǳʶٰ  
+		EMITTER tOther;
+		tOther.Storage.reserve(8);
+		tOther.Add_Group(L"Blood", 3, 0.f);
+		tOther.Add_Group(L"Spark", 5, 0.f);
+		const SLOT tSparkBefore = tOther.Groups[L"Spark"].pSlots[0];
+
+		CHECK(SUCCEEDED(CEmitter_Snapshot::Load(Bytes.data(), Bytes.size(), tOther.Groups, tOther.iRandomState)));
+		CHECK(tOther.iRandomState == tSaved.iRandomState);
+		CHECK(tOther.Groups[L"Blood"].bGroupEnabled == tSaved.Groups[L"Blood"].bGroupEnabled);
+		CHECK(tOther.Groups[L"Blood"].pSlots[2].fElapsed == tSaved.Groups[L"Blood"].pSlots[2].fElapsed);
+		CHECK(tOther.Groups[L"Spark"].pSlots[0].fInterval == tSparkBefore.fInterval);
+		CHECK(!tOther.Groups[L"Spark"].bGroupEnabled);
+		CHECK(tOther.Groups.size() == 2);
+	}
+
+	//   ص( ׷   ڶ) ׷// ¸ ϳ ٲ 
+	void Test_Emitter_Rollback()
+	{
+		EMITTER tSaved = Make_Emitter(2.f, 0x12345678u);
+
+		vector<_byte> Bytes;
+		CEmitter_Snapshot::Save(tSaved.Groups, tSaved.iRandomState, Bytes);
+
+		EMITTER tCurrent = Make_Emitter(0.f, 1u);
+		EMITTER tBefore = Make_Emitter(0.f, 1u);
+
+		_uint iNumAccepted = 0;
+		for (size_t iSize = 0; iSize < Bytes.size(); ++iSize)
+		{
+			// ̷ε ũ⸦ ߸ ̿   ˻ ϰ  ߰ ϵ
+			vector<_byte> Truncated(Bytes.begin(), Bytes.begin() + iSize);
+			if (iSize >= sizeof(SNAPSHOT_HEADER))
+			{
+				_uint iPayloadBytes = _uint(iSize - sizeof(SNAPSHOT_HEADER));
+				memcpy(Truncated.data() + offsetof(SNAPSHOT_HEADER, iPayloadBytes), &iPayloadBytes, sizeof(_uint));
+			}
+
+			if (SUCCEEDED(CEmitter_Snapshot::Load(Truncated.data(), Truncated.size(), tCurrent.Groups, tCurrent.iRandomState)))
+				++iNumAccepted;
+		}
+
+		CHECK(iNumAccepted == 0);
+		CHECK(Is_Equal(tBefore, tCurrent));
+
+		//  ڿ    
+		CHECK(SUCCEEDED(CEmitter_Snapshot::Load(Bytes.data(), Bytes.size(), tCurrent.Groups, tCurrent.iRandomState)));
+		CHECK(Is_Equal(tSaved, tCurrent));
+	}
+
+	void Test_String()
+	{
+		vector<_byte> Bytes;
+		{
+			CSnapshot_Writer Writer(Bytes);
+			Writer.Begin('STRS', 1);
+			Writer.Write_String(L"Effect_Blood");
+			Writer.Write_String(L"");
+			Writer.End();
+		}
+
+		CSnapshot_Reader Reader(Bytes.data(), Bytes.size());
+		_wstring wsFirst, wsSecond;
+		CHECK(Reader.Begin('STRS', 1));
+		CHECK(Reader.Read_String(wsFirst) && wsFirst == L"Effect_Blood");
+		CHECK(Reader.Read_String(wsSecond) && wsSecond.empty());
+
+		//  ʵ尡  ũ⺸ ũ Ҵ  
+		vector<_byte> BadLength = Bytes;
+		_uint iLength = 0x7FFFFFFFu;
+		memcpy(BadLength.data() + sizeof(SNAPSHOT_HEADER), &iLength, sizeof(_uint));
+
+		CSnapshot_Reader BadReader(BadLength.data(), BadLength.size());
+		_wstring wsBad;
+		CHECK(BadReader.Begin('STRS', 1));
+		CHECK(!BadReader.Read_String(wsBad));
+		CHECK(BadReader.Is_Failed());
+
+		//   ϸ  б⵵  
+		_uint iValue = {};
+		CHECK(!BadReader.Read(iValue));
+	}
+
+#if __has_include(<nlohmann/json.hpp>)
+	void Test_Json()
+	{
+		// Get_JsonData/Set_JsonData Ű պ,  Ű   
+		auto tParams = Make_Trail(0, 0).tParams;
+		json jData;
+		CTrail_Snapshot::To_Json(tParams, jData);
+		CHECK(jData.size() == 4);
+		CHECK(jData["iMaxTrailPoints"] == 64 && jData["iCatmullCount"] == 8);
+
+		CTrail_Snapshot::PARAMS tLoaded = { 1, 2, 3.f, 4.f };
+		CTrail_Snapshot::From_Json(jData, tLoaded);
+		CHECK(memcmp(&tLoaded, &tParams, sizeof(CTrail_Snapshot::PARAMS)) == 0);
+
+		CTrail_Snapshot::PARAMS tPartial = { 1, 2, 3.f, 4.f };
+		CTrail_Snapshot::From_Json(json{ { "fSampleRate", 90.f } }, tPartial);
+		CHECK(tPartial.iMaxTrailPoints == 1 && tPartial.iCatmullCount == 2 && tPartial.fSampleRate == 90.f && tPartial.fTessellationRate == 4.f);
+	}
+
+	// ó ( , /Ͽ  ޶Ƿ  )
+	// JSON (Get_JsonData/Set_JsonData) Ķ͸ ϹǷ  ( 0) ϰ,   ̳ʸ 
+	void Bench_Throughput()
+	{
+		const _uint iNumTrails = 256, iNumRounds = 20;
+
+		vector<CTrail_Snapshot::STATE> Trails, ParamsOnly;
+		for (_uint i = 0; i < iNumTrails; ++i)
+		{
+			Trails.push_back(Make_Trail(64, i));
+			ParamsOnly.push_back(Make_Trail(0, i));
+		}
+
+		auto Bench_Binary = [&](const vector<CTrail_Snapshot::STATE>& Source, size_t& iBytes, _bool& bOK)
+			{
+				vector<CTrail_Snapshot::STATE> Loaded(iNumTrails);
+				vector<_byte> Bytes;
+				vector<size_t> Offsets;
+
+				double fMs = Measure_Ms([&]() {
+					for (_uint iRound = 0; iRound < iNumRounds; ++iRound)
+					{
+						Bytes.clear();
+						Offsets.clear();
+						for (auto& tTrail : Source)
+						{
+							Offsets.push_back(Bytes.size());
+							CTrail_Snapshot::Save(tTrail, Bytes);
+						}
+						Offsets.push_back(Bytes.size());
+
+						for (_uint i = 0; i < iNumTrails; ++i)
+							bOK &= SUCCEEDED(CTrail_Snapshot::Load(Bytes.data() + Offsets[i], Offsets[i + 1] - Offsets[i], Loaded[i]));
+					}
+				});
+
+				for (_uint i = 0; i < iNumTrails; ++i)
+					bOK &= Is_Equal(Source[i], Loaded[i]);
+
+				iBytes = Bytes.size();
+				return fMs;
+			};
+
+		size_t iBinaryBytes = 0, iParamBytes = 0, iJsonBytes = 0;
+		_bool bBinaryOK = true, bParamOK = true, bJsonOK = true;
+
+		double fBinaryMs = Bench_Binary(Trails, iBinaryBytes, bBinaryOK);
+		double fParamMs = Bench_Binary(ParamsOnly, iParamBytes, bParamOK);
+
+		vector<_string> Texts(iNumTrails);
+		vector<CTrail_Snapshot::PARAMS> LoadedParams(iNumTrails);
+		double fJsonMs = Measure_Ms([&]() {
+			for (_uint iRound = 0; iRound < iNumRounds; ++iRound)
+			{
+				iJsonBytes = 0;
+				for (_uint i = 0; i < iNumTrails; ++i)
+				{
+					json jData;
+					CTrail_Snapshot::To_Json(ParamsOnly[i].tParams, jData);
+					Texts[i] = jData.dump();
+					iJsonBytes += Texts[i].size();
+				}
+
+				for (_uint i = 0; i < iNumTrails; ++i)
+					CTrail_Snapshot::From_Json(json::parse(Texts[i]), LoadedParams[i]);
+			}
+		});
+
+		for (_uint i = 0; i < iNumTrails; ++i)
+			bJsonOK &= memcmp(&LoadedParams[i], &ParamsOnly[i].tParams, sizeof(CTrail_Snapshot::PARAMS)) == 0;
+
+		CHECK(bBinaryOK);
+		CHECK(bParamOK);
+		CHECK(bJsonOK);
+
+		printf("snapshot: %u trails, %u rounds\n", iNumTrails, iNumRounds);
+		printf("  binary params      : %8.2f ms, %zu bytes\n", fParamMs, iParamBytes);
+		printf("  json params        : %8.2f ms, %zu bytes (x%.1f time)\n", fJsonMs, iJsonBytes, fJsonMs / max(fParamMs, 1e-3));
+		printf("  binary + 64 points : %8.2f ms, %zu bytes\n", fBinaryMs, iBinaryBytes);
+	}
+#endif
+}
+
+int main()
+{
+	Test_RoundTrip();
+	Test_Concatenated();
+	Test_Version1();
+	Test_Truncated();
+	Test_Corrupt();
+	Test_Emitter_RoundTrip();
+	Test_Emitter_Rollback();
+	Test_String();
+
+#if __has_include(<nlohmann/json.hpp>)
+	Test_Json();
+	Bench_Throughput();
+#endif
+
+	return TEST_RESULT();
+}
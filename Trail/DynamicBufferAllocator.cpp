@@ -0,0 +1,105 @@
+#include "DynamicBufferAllocator.h"
+
+HRESULT CDynamicBufferAllocator::Initialize(CDynamicBufferBackend* pBackend, _uint iNumRegions)
+{
+    if (!pBackend || iNumRegions == 0)
+        return E_FAIL;
+
+    //  ũ ۸ յ 
+    m_iRegionSize = pBackend->Get_ByteWidth() / iNumRegions;
+    if (m_iRegionSize == 0)
+        return E_FAIL;
+
+    m_pBackend = pBackend;
+    Safe_AddRef(m_pBackend);
+
+    m_RegionFrames.assign(iNumRegions, INVALID_FRAME);
+    m_iCurRegion = iNumRegions - 1; // ù Map  0
+
+    return S_OK;
+}
+
+void CDynamicBufferAllocator::Begin_Frame()
+{
+    ++m_iFrameIndex;
+
+    m_tFrameStats = {};
+    m_tFrameStats.iFrameIndex = m_iFrameIndex;
+}
+
+HRESULT CDynamicBufferAllocator::Map_Region(_uint iBytes, ALLOCATION* pOut)
+{
+    if (!pOut || m_bMapped || iBytes > m_iRegionSize)
+        return E_FAIL;
+
+    //   ̵
+    _uint iRegion = (m_iCurRegion + 1) % Get_NumRegions();
+
+    //     0  DISCARD(   GPU  д   )
+    // DISCARD   1..N-1  ޸𸮶 NO_OVERWRITE 
+    _bool bDiscard = (iRegion == 0);
+
+    void* pData = nullptr;
+    if (FAILED(m_pBackend->Map(bDiscard ? CDynamicBufferBackend::MAP_DISCARD : CDynamicBufferBackend::MAP_NO_OVERWRITE, &pData)))
+        return E_FAIL;
+
+    m_bMapped = true;
+    m_iCurRegion = iRegion;
+    m_RegionFrames[iRegion] = m_iFrameIndex;
+
+    if (bDiscard)
+    {
+        ++m_tFrameStats.iWrapCount;
+        ++m_iTotalWrapCount;
+    }
+
+    ++m_tFrameStats.iNumAllocations;
+
+    pOut->iRegion = iRegion;
+    pOut->iByteOffset = iRegion * m_iRegionSize;
+    pOut->pData = static_cast<_byte*>(pData) + pOut->iByteOffset;
+    pOut->bDiscard = bDiscard;
+
+    return S_OK;
+}
+
+void CDynamicBufferAllocator::Unmap_Region(_uint iBytesWritten)
+{
+    if (!m_bMapped)
+        return;
+
+    m_tFrameStats.iBytesUploaded += min(iBytesWritten, m_iRegionSize);
+
+    m_pBackend->Unmap();
+    m_bMapped = false;
+}
+
+_int CDynamicBufferAllocator::Find_RegionOfFrame(_uint64 iFrameIndex) const
+{
+    for (_uint i = 0; i < Get_NumRegions(); ++i)
+    {
+        if (m_RegionFrames[i] == iFrameIndex)
+            return (_int)i;
+    }
+
+    return -1;
+}
+
+CDynamicBufferAllocator* CDynamicBufferAllocator::Create(CDynamicBufferBackend* pBackend, _uint iNumRegions)
+{
+    CDynamicBufferAllocator* pInstance = new CDynamicBufferAllocator();
+    if (FAILED(pInstance->Initialize(pBackend, iNumRegions)))
+    {
+        MSG_BOX("Failed to Create: CDynamicBufferAllocator");
+        Safe_Release(pInstance);
+    }
+    return pInstance;
+}
+
+void CDynamicBufferAllocator::Free()
+{
+    __super::Free();
+
+    Unmap_Region(0);
+    Safe_Release(m_pBackend);
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "DynamicBufferBackend.h"
+
+BEGIN(Engine)
+
+// ϳ  ۸  ũ  N  ȯ ϴ Ҵ
+//  0 ƿ ( ) ׻ DISCARD   ޸𸮸 ް,      NO_OVERWRITE
+// GPU    ϰ (DXGI ⺻ ִ  3 ),     
+//  ȣ /׿̸ ڰ ǥ Ӹ   ȣϴ Begin_Frameθ 
+class ENGINE_DLL CDynamicBufferAllocator final : public CBase
+{
+public:
+	struct ALLOCATION
+	{
+		_byte*		pData = { nullptr };	//   ּ(Map  )
+		_uint		iByteOffset = {};		//  κ Ʈ 
+		_uint		iRegion = {};
+		_bool		bDiscard = { false };
+	};
+
+	struct FRAME_STATS
+	{
+		_uint64		iFrameIndex = {};
+		_uint		iBytesUploaded = {};
+		_uint		iNumAllocations = {};
+		_uint		iWrapCount = {};
+	};
+
+private:
+	CDynamicBufferAllocator() = default;
+	virtual ~CDynamicBufferAllocator() = default;
+
+public:
+	HRESULT					Initialize(CDynamicBufferBackend* pBackend, _uint iNumRegions);
+
+public:
+	//  (ǥ Ӹ  , Render ȣ ),  ʱȭ   ȣ 
+	void					Begin_Frame();
+	// iBytes ̹  ִ ũ,   ũ Unmap  迡 ݿ
+	HRESULT					Map_Region(_uint iBytes, ALLOCATION* pOut);
+	void					Unmap_Region(_uint iBytesWritten);
+
+	_uint					Get_RegionSize() const { return m_iRegionSize; }
+	_uint					Get_NumRegions() const { return (_uint)m_RegionFrames.size(); }
+	_uint64					Get_FrameIndex() const { return m_iFrameIndex; }
+	// ش   , ̹ ưų  -1
+	_int					Find_RegionOfFrame(_uint64 iFrameIndex) const;
+	const FRAME_STATS&		Get_FrameStats() const { return m_tFrameStats; }
+	_uint64					Get_TotalWrapCount() const { return m_iTotalWrapCount; }
+
+private:
+	static constexpr _uint64 INVALID_FRAME = ~0ull;
+
+	CDynamicBufferBackend*	m_pBackend = { nullptr };
+
+	_uint					m_iRegionSize = {};
+	_uint					m_iCurRegion = {};
+	_bool					m_bMapped = { false };
+
+	vector<_uint64>			m_RegionFrames;	//     ȣ
+
+	_uint64					m_iFrameIndex = {};
+	FRAME_STATS				m_tFrameStats = {};
+	_uint64					m_iTotalWrapCount = {};
+
+public:
+	static CDynamicBufferAllocator* Create(CDynamicBufferBackend* pBackend, _uint iNumRegions);
+	virtual void			Free() override;
+};
+
+END
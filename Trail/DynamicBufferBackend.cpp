@@ -0,0 +1,47 @@
+#include "DynamicBufferBackend.h"
+
+void CDynamicBufferBackend::Free()
+{
+    __super::Free();
+}
+
+CDynamicBufferBackend_Null::CDynamicBufferBackend_Null(_uint iByteWidth)
+    : m_Memory(iByteWidth, 0)
+{
+}
+
+HRESULT CDynamicBufferBackend_Null::Map(MAPTYPE eMapType, void** ppData)
+{
+    // ø Map D3D  
+    if (m_bMapped || !ppData || m_Memory.empty())
+        return E_FAIL;
+
+    if (eMapType == MAP_DISCARD)
+    {
+        memset(m_Memory.data(), 0xCD, m_Memory.size());
+        ++m_iNumDiscards;
+    }
+
+    ++m_iNumMaps;
+    m_bMapped = true;
+    *ppData = m_Memory.data();
+
+    return S_OK;
+}
+
+void CDynamicBufferBackend_Null::Unmap()
+{
+    m_bMapped = false;
+}
+
+CDynamicBufferBackend_Null* CDynamicBufferBackend_Null::Create(_uint iByteWidth)
+{
+    return new CDynamicBufferBackend_Null(iByteWidth);
+}
+
+void CDynamicBufferBackend_Null::Free()
+{
+    __super::Free();
+
+    m_Memory.clear();
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "Base.h"
+
+BEGIN(Engine)
+
+//   Map/Unmap ߻ȭ 鿣
+// Ҵ (CDynamicBufferAllocator) GPU ̵ ϵ D3D11 (DynamicBufferBackend_D3D11) Null  и
+class ENGINE_DLL CDynamicBufferBackend abstract : public CBase
+{
+public:
+	enum MAPTYPE { MAP_DISCARD, MAP_NO_OVERWRITE, MAP_END };
+
+protected:
+	CDynamicBufferBackend() = default;
+	virtual ~CDynamicBufferBackend() = default;
+
+public:
+	virtual HRESULT			Map(MAPTYPE eMapType, void** ppData) = 0;
+	virtual void			Unmap() = 0;
+	virtual _uint			Get_ByteWidth() const = 0;
+
+public:
+	virtual void			Free() override;
+};
+
+// ý ޸ 鿣(GPU  ȯ濡 Ҵ  )
+// DISCARD     ʴ´ٴ D3D Ģ 䳻  ۸ 0xCD ä
+class ENGINE_DLL CDynamicBufferBackend_Null final : public CDynamicBufferBackend
+{
+private:
+	CDynamicBufferBackend_Null(_uint iByteWidth);
+	virtual ~CDynamicBufferBackend_Null() = default;
+
+public:
+	virtual HRESULT			Map(MAPTYPE eMapType, void** ppData) override;
+	virtual void			Unmap() override;
+	virtual _uint			Get_ByteWidth() const override { return (_uint)m_Memory.size(); }
+
+	const _byte*			Get_Memory() const { return m_Memory.data(); }
+	_uint					Get_NumMaps() const { return m_iNumMaps; }
+	_uint					Get_NumDiscards() const { return m_iNumDiscards; }
+	_bool					Is_Mapped() const { return m_bMapped; }
+
+private:
+	vector<_byte>			m_Memory;
+	_uint					m_iNumMaps = {};
+	_uint					m_iNumDiscards = {};
+	_bool					m_bMapped = { false };
+
+public:
+	static CDynamicBufferBackend_Null* Create(_uint iByteWidth);
+	virtual void			Free() override;
+};
+
+END
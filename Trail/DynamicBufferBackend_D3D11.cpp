@@ -0,0 +1,50 @@
+#include "DynamicBufferBackend_D3D11.h"
+
+CDynamicBufferBackend_D3D11::CDynamicBufferBackend_D3D11(ID3D11DeviceContext* pContext, ID3D11Buffer* pBuffer, _uint iByteWidth)
+    : m_pContext{ pContext }
+    , m_pBuffer{ pBuffer }
+    , m_iByteWidth{ iByteWidth }
+{
+    Safe_AddRef(m_pContext);
+    Safe_AddRef(m_pBuffer);
+}
+
+HRESULT CDynamicBufferBackend_D3D11::Map(MAPTYPE eMapType, void** ppData)
+{
+    if (!m_pBuffer || !ppData)
+        return E_FAIL;
+
+    D3D11_MAPPED_SUBRESOURCE mappedResource = {};
+    D3D11_MAP eMap = (eMapType == MAP_DISCARD) ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+    if (FAILED(m_pContext->Map(m_pBuffer, 0, eMap, 0, &mappedResource)))
+        return E_FAIL;
+
+    *ppData = mappedResource.pData;
+
+    return S_OK;
+}
+
+void CDynamicBufferBackend_D3D11::Unmap()
+{
+    m_pContext->Unmap(m_pBuffer, 0);
+}
+
+CDynamicBufferBackend_D3D11* CDynamicBufferBackend_D3D11::Create(ID3D11DeviceContext* pContext, ID3D11Buffer* pBuffer, _uint iByteWidth)
+{
+    if (!pContext || !pBuffer || iByteWidth == 0)
+    {
+        MSG_BOX("Failed to Create: CDynamicBufferBackend_D3D11");
+        return nullptr;
+    }
+
+    return new CDynamicBufferBackend_D3D11(pContext, pBuffer, iByteWidth);
+}
+
+void CDynamicBufferBackend_D3D11::Free()
+{
+    __super::Free();
+
+    Safe_Release(m_pBuffer);
+    Safe_Release(m_pContext);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "DynamicBufferBackend.h"
+
+BEGIN(Engine)
+
+//  ID3D11Buffer  鿣
+class ENGINE_DLL CDynamicBufferBackend_D3D11 final : public CDynamicBufferBackend
+{
+private:
+	CDynamicBufferBackend_D3D11(ID3D11DeviceContext* pContext, ID3D11Buffer* pBuffer, _uint iByteWidth);
+	virtual ~CDynamicBufferBackend_D3D11() = default;
+
+public:
+	virtual HRESULT			Map(MAPTYPE eMapType, void** ppData) override;
+	virtual void			Unmap() override;
+	virtual _uint			Get_ByteWidth() const override { return m_iByteWidth; }
+
+private:
+	ID3D11DeviceContext*	m_pContext = { nullptr };
+	ID3D11Buffer*			m_pBuffer = { nullptr };
+	_uint					m_iByteWidth = {};
+
+public:
+	static CDynamicBufferBackend_D3D11* Create(ID3D11DeviceContext* pContext, ID3D11Buffer* pBuffer, _uint iByteWidth);
+	virtual void			Free() override;
+};
+
+END
@@ -0,0 +1,126 @@
+#pragma once
+#include "Engine_Defines.h"
+
+BEGIN(Engine)
+
+// Ʈ  ̳ʸ  
+// [ 4Ʈ][ 2Ʈ][ 2Ʈ][̷ε ũ 4Ʈ] + ̷ε(Ʋ , Ʈ  ״)
+// JSON ο ޸ Ľ/ڿ ȯ  memcpy  ->  Ʈ, ,  ǰ
+struct SNAPSHOT_HEADER
+{
+	_uint		iMagic;
+	_ushort		iVersion;
+	_ushort		iReserved;
+	_uint		iPayloadBytes;
+};
+
+class CSnapshot_Writer final
+{
+public:
+	explicit CSnapshot_Writer(vector<_byte>& Out) : m_Out(Out) {}
+
+public:
+	void		Begin(_uint iMagic, _ushort iVersion)
+	{
+		m_iHeaderOffset = m_Out.size();
+
+		SNAPSHOT_HEADER tHeader = { iMagic, iVersion, 0, 0 };
+		Write(tHeader);
+	}
+
+	//  ̷ε ũ 
+	void		End()
+	{
+		_uint iPayloadBytes = _uint(m_Out.size() - m_iHeaderOffset - sizeof(SNAPSHOT_HEADER));
+		memcpy(m_Out.data() + m_iHeaderOffset + offsetof(SNAPSHOT_HEADER, iPayloadBytes), &iPayloadBytes, sizeof(_uint));
+	}
+
+	template<typename T>
+	void		Write(const T& Value)
+	{
+		static_assert(is_trivially_copyable_v<T>, "snapshot values must be trivially copyable");
+		Write_Bytes(&Value, sizeof(T));
+	}
+
+	void		Write_Bytes(const void* pData, size_t iSize)
+	{
+		const _byte* pBytes = static_cast<const _byte*>(pData);
+		m_Out.insert(m_Out.end(), pBytes, pBytes + iSize);
+	}
+
+	void		Write_String(const _wstring& wsValue)
+	{
+		Write((_uint)wsValue.size());
+		Write_Bytes(wsValue.data(), wsValue.size() * sizeof(_wstring::value_type));
+	}
+
+private:
+	vector<_byte>&	m_Out;
+	size_t			m_iHeaderOffset = {};
+};
+
+class CSnapshot_Reader final
+{
+public:
+	CSnapshot_Reader(const _byte* pData, size_t iSize) : m_pData(pData), m_iSize(iSize) {}
+
+public:
+	//  ٸų   ̸ ,     
+	_bool		Begin(_uint iMagic, _ushort iMaxVersion, _ushort* pVersion = nullptr)
+	{
+		SNAPSHOT_HEADER tHeader = {};
+		if (!Read(tHeader) || tHeader.iMagic != iMagic || tHeader.iVersion > iMaxVersion)
+			return Fail();
+
+		if (tHeader.iPayloadBytes > m_iSize - m_iOffset)
+			return Fail();
+
+		m_iSize = m_iOffset + tHeader.iPayloadBytes;
+
+		if (pVersion)
+			*pVersion = tHeader.iVersion;
+
+		return true;
+	}
+
+	template<typename T>
+	_bool		Read(T& Value)
+	{
+		static_assert(is_trivially_copyable_v<T>, "snapshot values must be trivially copyable");
+		return Read_Bytes(&Value, sizeof(T));
+	}
+
+	_bool		Read_Bytes(void* pData, size_t iSize)
+	{
+		if (m_bFailed || iSize > m_iSize - m_iOffset)
+			return Fail();
+
+		memcpy(pData, m_pData + m_iOffset, iSize);
+		m_iOffset += iSize;
+
+		return true;
+	}
+
+	_bool		Read_String(_wstring& wsValue)
+	{
+		_uint iLength = {};
+		if (!Read(iLength) || size_t(iLength) * sizeof(_wstring::value_type) > m_iSize - m_iOffset)
+			return Fail();
+
+		wsValue.resize(iLength);
+		return Read_Bytes(wsValue.data(), size_t(iLength) * sizeof(_wstring::value_type));
+	}
+
+	_bool		Is_Failed() const { return m_bFailed; }
+
+private:
+	_bool		Fail() { m_bFailed = true; return false; }
+
+private:
+	const _byte*	m_pData = { nullptr };
+	size_t			m_iSize = {};
+	size_t			m_iOffset = {};
+	_bool			m_bFailed = { false };
+};
+
+END
@@ -0,0 +1,89 @@
+#include "Trail_Snapshot.h"
+#include "Snapshot_Stream.h"
+
+void CTrail_Snapshot::Save(const STATE& tState, vector<_byte>& Out)
+{
+    CSnapshot_Writer Writer(Out);
+    Writer.Begin(MAGIC, VERSION);
+
+    Writer.Write(tState.tParams.iMaxTrailPoints);
+    Writer.Write(tState.tParams.iCatmullCount);
+    Writer.Write(tState.tParams.fSampleRate);
+    Writer.Write(tState.tParams.fTessellationRate);
+    Writer.Write(tState.fTime);
+    Writer.Write((_uint)tState.Samples.size());
+
+    for (auto& tSample : tState.Samples)
+    {
+        Writer.Write(tSample.vLow);
+        Writer.Write(tSample.vHigh);
+        Writer.Write(tSample.fTime);
+    }
+
+    Writer.End();
+}
+
+HRESULT CTrail_Snapshot::Load(const _byte* pData, size_t iSize, STATE& tState)
+{
+    CSnapshot_Reader Reader(pData, iSize);
+
+    _ushort iVersion = {};
+    if (!Reader.Begin(MAGIC, VERSION, &iVersion))
+        return E_FAIL;
+
+    STATE tLoaded;
+    tLoaded.tParams = tState.tParams;
+    tLoaded.fTime = tState.fTime;
+
+    if (!Reader.Read(tLoaded.tParams.iMaxTrailPoints) || !Reader.Read(tLoaded.tParams.iCatmullCount))
+        return E_FAIL;
+
+    if (iVersion >= 2)
+    {
+        if (!Reader.Read(tLoaded.tParams.fSampleRate) || !Reader.Read(tLoaded.tParams.fTessellationRate) || !Reader.Read(tLoaded.fTime))
+            return E_FAIL;
+    }
+
+    _uint iNumSamples = {};
+    if (!Reader.Read(iNumSamples) || tLoaded.tParams.iMaxTrailPoints < 0 || iNumSamples > (_uint)tLoaded.tParams.iMaxTrailPoints)
+        return E_FAIL;
+
+    //  1 ð Ƿ  ֱ   ð ο
+    _float fSampleInterval = 1.f / max(tLoaded.tParams.fSampleRate, 1.f);
+
+    tLoaded.Samples.resize(iNumSamples);
+    for (_uint i = 0; i < iNumSamples; ++i)
+    {
+        SAMPLE& tSample = tLoaded.Samples[i];
+        if (!Reader.Read(tSample.vLow) || !Reader.Read(tSample.vHigh))
+            return E_FAIL;
+
+        tSample.fTime = tLoaded.fTime - _float(iNumSamples - 1 - i) * fSampleInterval;
+        if (iVersion >= 2 && !Reader.Read(tSample.fTime))
+            return E_FAIL;
+    }
+
+    tState = move(tLoaded);
+
+    return S_OK;
+}
+
+void CTrail_Snapshot::To_Json(const PARAMS& tParams, json& jData)
+{
+    jData["iMaxTrailPoints"] = tParams.iMaxTrailPoints;
+    jData["iCatmullCount"] = tParams.iCatmullCount;
+    jData["fSampleRate"] = tParams.fSampleRate;
+    jData["fTessellationRate"] = tParams.fTessellationRate;
+}
+
+void CTrail_Snapshot::From_Json(const json& jData, PARAMS& tParams)
+{
+    if (jData.contains("iMaxTrailPoints"))
+        tParams.iMaxTrailPoints = jData["iMaxTrailPoints"];
+    if (jData.contains("iCatmullCount"))
+        tParams.iCatmullCount = jData["iCatmullCount"];
+    if (jData.contains("fSampleRate"))
+        tParams.fSampleRate = jData["fSampleRate"];
+    if (jData.contains("fTessellationRate"))
+        tParams.fTessellationRate = jData["fTessellationRate"];
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Engine_Defines.h"
+
+BEGIN(Engine)
+
+// CVIBuffer_Trail  ȭ(̳ʸ  ̷ε + JSON Ķ Ű)
+// ̽  ʴ κи иؼ  Ŭ ׽Ʈ  ڵ带 
+class CTrail_Snapshot final
+{
+public:
+	// Get_JsonData/Set_JsonData Ǵ Ķ
+	struct PARAMS
+	{
+		_int		iMaxTrailPoints = {};
+		_int		iCatmullCount = {};
+		_float		fSampleRate = { 60.f };
+		_float		fTessellationRate = {};
+	};
+
+	struct SAMPLE
+	{
+		_float3		vLow;
+		_float3		vHigh;
+		_float		fTime;
+	};
+
+	struct STATE
+	{
+		PARAMS			tParams;
+		_float			fTime = {};		// Ʈ ð
+		vector<SAMPLE>	Samples;		//  
+	};
+
+	static constexpr _uint		MAGIC = 'TRLS';
+	static constexpr _ushort	VERSION = 2;	// 2:  Ÿӽ, /׼̼ ֱ
+
+public:
+	static void		Save(const STATE& tState, vector<_byte>& Out);
+	// tState  ¸ ä ѱ( 1  ֱ/ð   )
+	//  а  ڿ tState ݿ,   tState ״
+	static HRESULT	Load(const _byte* pData, size_t iSize, STATE& tState);
+
+	static void		To_Json(const PARAMS& tParams, json& jData);
+	//  Ű   
+	static void		From_Json(const json& jData, PARAMS& tParams);
+};
+
+END
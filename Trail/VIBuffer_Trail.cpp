@@ -1,4 +1,23 @@
 #include "VIBuffer_Trail.h"
+#include "DynamicBufferBackend_D3D11.h"
+#include "Trail_Snapshot.h"
+
+namespace
+{
+    // Ÿӽ () Catmull-Rom
+    //  = (P[k+1] - P[k-1]) / (t[k+1] - t[k-1])  (t2 - t1) ؼ Hermite 
+    // ð    XMVectorCatmullRom  
+    _vector Interpolate_Timed(const _vector(&vP)[4], const _float(&fT)[4], _float s)
+    {
+        const _float fEpsilon = 1e-5f;
+
+        _float fSegment = max(fT[2] - fT[1], fEpsilon);
+        _vector vTangent1 = (vP[2] - vP[0]) * (fSegment / max(fT[2] - fT[0], fEpsilon));
+        _vector vTangent2 = (vP[3] - vP[1]) * (fSegment / max(fT[3] - fT[1], fEpsilon));
+
+        return XMVectorHermite(vP[1], vTangent1, vP[2], vTangent2, s);
+    }
+}
 
 CVIBuffer_Trail::CVIBuffer_Trail(ID3D11Device* pDevice, ID3D11DeviceContext* pContext)
     : CVIBuffer_Instancing(pDevice, pContext)
@@ -96,22 +115,38 @@ HRESULT CVIBuffer_Trail::Initialize_Prototype(CVIBuffer_Instancing::INSTANCE_DES
 HRESULT CVIBuffer_Trail::Initialize(void* pArg)
 {
 #pragma region Vertex_Buffer
+    if (m_iNumVertices == 0)
+        return S_OK;
+
+    //  ũ  NUM_FRAME_REGIONS ϳ ۿ  ġ
+    _uint iRegionVertices = m_iNumVertices;
+    _uint iTotalVertices = iRegionVertices * NUM_FRAME_REGIONS;
+
     D3D11_BUFFER_DESC vertexDesc = {};
-    vertexDesc.ByteWidth = m_iVertexStride * m_iNumVertices;
+    vertexDesc.ByteWidth = m_iVertexStride * iTotalVertices;
     vertexDesc.Usage = D3D11_USAGE_DYNAMIC;
     vertexDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     vertexDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-    vector<VTXTRAIL> initialVertices(m_iNumVertices);
-    for (_int i = 0; i < m_iNumVertices; ++i)
+    vector<VTXTRAIL> initialVertices(iTotalVertices);
+    for (_uint i = 0; i < iTotalVertices; ++i)
         initialVertices[i].vPosition = _float3(0.f, 0.f, 0.f);
 
     D3D11_SUBRESOURCE_DATA vertexData = {};
     vertexData.pSysMem = initialVertices.data();
 
-    m_pDevice->CreateBuffer(&vertexDesc, &vertexData, &m_pVB);
+    if (FAILED(m_pDevice->CreateBuffer(&vertexDesc, &vertexData, &m_pVB)))
+        return E_FAIL;
 #pragma endregion
 
+    m_pVBBackend = CDynamicBufferBackend_D3D11::Create(m_pContext, m_pVB, vertexDesc.ByteWidth);
+    if (!m_pVBBackend)
+        return E_FAIL;
+
+    m_pVBAllocator = CDynamicBufferAllocator::Create(m_pVBBackend, NUM_FRAME_REGIONS);
+    if (!m_pVBAllocator)
+        return E_FAIL;
+
     return S_OK;
 }
 
@@ -120,29 +155,89 @@ HRESULT CVIBuffer_Trail::Render()
     if (m_iNumInstances < 2)
         return E_FAIL;
 
-    m_pContext->DrawIndexed(m_iCurIndexCnt, 0, 0);
+    // ε ۴ ״ ΰ ̹     Űܼ ׸
+    m_pContext->DrawIndexed(m_iCurIndexCnt, 0, m_iBaseVertex);
 
     return S_OK;
 }
 
 void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
 {
-    if (!m_TrailPoints.empty())
+    //   ȣ  ֱ   ð 
+    _float fTime = m_TrailPoints.empty() ? m_fTime : m_TrailPoints.back().fTime + 1.f / m_fSampleRate;
+    m_fTime = fTime;
+
+    Push_Sample(vSwordLow, vSwordHigh, fTime);
+
+    Build_Vertices();
+    m_bVerticesDirty = false;
+}
+
+_uint CVIBuffer_Trail::Advance(_float fTimeDelta, const SAMPLER& Sampler)
+{
+    if (!Sampler || fTimeDelta <= 0.f)
+        return 0;
+
+    const _float fStep = 1.f / m_fSampleRate;
+
+    m_fSampleAcc += fTimeDelta;
+    _uint iNumDue = _uint(m_fSampleAcc / fStep);
+    m_fSampleAcc -= iNumDue * fStep;
+
+    // ̹    ð =  ð -   ð
+    m_fTime += fTimeDelta;
+    _float fLastSample = m_fTime - m_fSampleAcc;
+
+    //  ġ   ŭ 
+    _uint iFirst = (iNumDue > (_uint)m_iMaxTrailPoints) ? iNumDue - (_uint)m_iMaxTrailPoints : 0;
+
+    for (_uint i = iFirst; i < iNumDue; ++i)
     {
-        _vector vPrevLow = m_TrailPoints.back().vLow;
-        _vector vPrevHigh = m_TrailPoints.back().vHight;
+        _float fSampleTime = fLastSample - _float(iNumDue - 1 - i) * fStep;
+
+        _vector vLow = XMVectorZero(), vHigh = XMVectorZero();
+        Sampler(fSampleTime, &vLow, &vHigh);
 
-        _vector vPrevDir = XMVector3Normalize(vPrevHigh - vPrevLow);
-        _vector vCurDir = XMVector3Normalize(vSwordHigh - vSwordLow);
+        Push_Sample(vLow, vHigh, fSampleTime);
     }
 
+    return iNumDue - iFirst;
+}
+
+void CVIBuffer_Trail::Push_Sample(_fvector vSwordLow, _fvector vSwordHigh, _float fTime)
+{
+    // ð Ųٷ   Ƿ 
+    if (!m_TrailPoints.empty() && fTime <= m_TrailPoints.back().fTime)
+        return;
+
     //   ߰
-    m_TrailPoints.push_back({ vSwordLow, vSwordHigh });
+    m_TrailPoints.push_back({ vSwordLow, vSwordHigh, fTime });
 
     //  ǽð  ȭ   while
     while (m_TrailPoints.size() > m_iMaxTrailPoints)
         m_TrailPoints.pop_front();
 
+    m_bVerticesDirty = true;
+}
+
+void CVIBuffer_Trail::Update_Tessellation(_float fTimeDelta)
+{
+    m_fTessellationAcc += fTimeDelta;
+
+    if (!m_bVerticesDirty)
+        return;
+
+    if (m_fTessellationRate > 0.f && m_fTessellationAcc < 1.f / m_fTessellationRate)
+        return;
+
+    m_fTessellationAcc = 0.f;
+
+    Build_Vertices();
+    m_bVerticesDirty = false;
+}
+
+void CVIBuffer_Trail::Build_Vertices()
+{
     // Catmull-Rom   ּ    Ȯ
     _int iNumActualPoints = (_int)m_TrailPoints.size();
     if (iNumActualPoints < 2) // ּ 2  ־ ̶ ׸  ִ
@@ -170,11 +265,17 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
     }
 
     // ؽ  Ʈ
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    if (FAILED(m_pContext->Map(m_pVB, 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedResource)))
+    // GPU д   ִ       
+    if (!m_pVBAllocator)
+        return;
+
+    CDynamicBufferAllocator::ALLOCATION tAlloc = {};
+    if (FAILED(m_pVBAllocator->Map_Region(m_iVertexStride * m_iNumVertices, &tAlloc)))
         return;
 
-    VTXTRAIL* pVertices = reinterpret_cast<VTXTRAIL*>(mappedResource.pData);
+    m_iBaseVertex = (_int)(tAlloc.iByteOffset / m_iVertexStride);
+
+    VTXTRAIL* pVertices = reinterpret_cast<VTXTRAIL*>(tAlloc.pData);
     _int iVtxIdx = 0;
 
     //  Catmull-Rom  ݺ(numActualPoints >= 4   ϰ )
@@ -182,15 +283,14 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
     _int iCurveCount = iNumActualPoints - 3; //   CurveCount
     if (iCurveCount > 0) { // NumActualPoints >= 4
         for (_int i = 0; i < iCurveCount; ++i) {
-            _vector vP0_low = m_TrailPoints[i + 0].vLow;
-            _vector vP1_low = m_TrailPoints[i + 1].vLow;
-            _vector vP2_low = m_TrailPoints[i + 2].vLow;
-            _vector vP3_low = m_TrailPoints[i + 3].vLow;
-            
-            _vector vP0_high = m_TrailPoints[i + 0].vHight;
-            _vector vP1_high = m_TrailPoints[i + 1].vHight;
-            _vector vP2_high = m_TrailPoints[i + 2].vHight;
-            _vector vP3_high = m_TrailPoints[i + 3].vHight;
+            _vector vP_low[4], vP_high[4];
+            _float fT[4];
+            for (_int k = 0; k < 4; ++k)
+            {
+                vP_low[k] = m_TrailPoints[i + k].vLow;
+                vP_high[k] = m_TrailPoints[i + k].vHight;
+                fT[k] = m_TrailPoints[i + k].fTime;
+            }
 
             for (_int j = 0; j < m_iCatmullCount; ++j) {
                 _float t = (m_iCatmullCount == 1) ? 0.f : _float(j) / _float(m_iCatmullCount - 1);
@@ -201,8 +301,8 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
                     continue;
                 }
 
-                _vector vInterpLow = XMVectorCatmullRom(vP0_low, vP1_low, vP2_low, vP3_low, t);
-                _vector vInterpHigh = XMVectorCatmullRom(vP0_high, vP1_high, vP2_high, vP3_high, t);
+                _vector vInterpLow = Interpolate_Timed(vP_low, fT, t);
+                _vector vInterpHigh = Interpolate_Timed(vP_high, fT, t);
 
                 XMStoreFloat3(&pVertices[iVtxIdx].vPosition, vInterpLow);
                 // Vǥ  m_iNumVertices  m_iNumVertices_ThisFrame  Ǵ m_iNumVertices Ʈ
@@ -222,28 +322,37 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
     // NumActualPoints 3 : P0=TP[0], P1=TP[1], P2=TP[2], P3=TP[2]+(TP[2]-TP[1])(ܻ)
     // NumActualPoints 4 ̻ : P0=TP[N-3], P1=TP[N-2], P2=TP[N-1], P3=TP[N-1]+(TP[N-1]-TP[N-2])(ܻ)
     if (iNumActualPoints >= 2) {
-        _vector vP0_Low_Final, vP1_Low_Final, vP2_Low_Final, vP3_Low_Final;
-        _vector vP0_High_Final, vP1_High_Final, vP2_High_Final, vP3_High_Final;
+        _vector vP_Low_Final[4], vP_High_Final[4];
+        _float fT_Final[4];
+
+        vP_Low_Final[2] = m_TrailPoints[iNumActualPoints - 1].vLow; //   ġ(P2)
+        vP_High_Final[2] = m_TrailPoints[iNumActualPoints - 1].vHight;
+        vP_Low_Final[1] = m_TrailPoints[iNumActualPoints - 2].vLow; //   ġ(P1)
+        vP_High_Final[1] = m_TrailPoints[iNumActualPoints - 2].vHight;
 
-        vP2_Low_Final = m_TrailPoints[iNumActualPoints - 1].vLow; //   ġ(P2)
-        vP2_High_Final = m_TrailPoints[iNumActualPoints - 1].vHight;
-        vP1_Low_Final = m_TrailPoints[iNumActualPoints - 2].vLow; //   ġ(P1)
-        vP1_High_Final = m_TrailPoints[iNumActualPoints - 2].vHight;
+        fT_Final[2] = m_TrailPoints[iNumActualPoints - 1].fTime;
+        fT_Final[1] = m_TrailPoints[iNumActualPoints - 2].fTime;
+        _float fLastSegment = fT_Final[2] - fT_Final[1];
 
         if (iNumActualPoints == 2) { //  2(TP[0], TP[1])
-            vP0_Low_Final = vP1_Low_Final;   // P0 = P1(TP[0])
-            vP0_High_Final = vP1_High_Final;
-            vP3_Low_Final = vP2_Low_Final;   // P3 = P2 (TP[1]):  
-            vP3_High_Final = vP2_High_Final;
+            vP_Low_Final[0] = vP_Low_Final[1];   // P0 = P1(TP[0])
+            vP_High_Final[0] = vP_High_Final[1];
+            vP_Low_Final[3] = vP_Low_Final[2];   // P3 = P2 (TP[1]):  
+            vP_High_Final[3] = vP_High_Final[2];
+            fT_Final[0] = fT_Final[1] - fLastSegment;
         }
         else { //  3 ̻(TP[N-3], TP[N-2], TP[N-1])
-            vP0_Low_Final = m_TrailPoints[iNumActualPoints - 3].vLow; // P0
-            vP0_High_Final = m_TrailPoints[iNumActualPoints - 3].vHight;
+            vP_Low_Final[0] = m_TrailPoints[iNumActualPoints - 3].vLow; // P0
+            vP_High_Final[0] = m_TrailPoints[iNumActualPoints - 3].vHight;
+            fT_Final[0] = m_TrailPoints[iNumActualPoints - 3].fTime;
             // P3 ܻ: P3 = P2 + (P2 - P1)
-            vP3_Low_Final = XMVectorAdd(vP2_Low_Final, XMVectorSubtract(vP2_Low_Final, vP1_Low_Final));
-            vP3_High_Final = XMVectorAdd(vP2_High_Final, XMVectorSubtract(vP2_High_Final, vP1_High_Final));
+            vP_Low_Final[3] = XMVectorAdd(vP_Low_Final[2], XMVectorSubtract(vP_Low_Final[2], vP_Low_Final[1]));
+            vP_High_Final[3] = XMVectorAdd(vP_High_Final[2], XMVectorSubtract(vP_High_Final[2], vP_High_Final[1]));
         }
 
+        // ܻ/    ̸ŭ  ð 
+        fT_Final[3] = fT_Final[2] + fLastSegment;
+
         // j_start_offset:   ̹ P1_final شϴ  ߰ 1 (ߺ )
         //    ʾҴٸ(NumActualPoints < 4), 0 
         _int j_start_offset = (iCurveCount > 0) ? 1 : 0;
@@ -253,8 +362,8 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
         for (_int j = j_start_offset; j < m_iCatmullCount; ++j) {
             _float t = (m_iCatmullCount == 1) ? 0.f : _float(j) / _float(m_iCatmullCount - 1);
 
-            _vector vInterpLow = XMVectorCatmullRom(vP0_Low_Final, vP1_Low_Final, vP2_Low_Final, vP3_Low_Final, t);
-            _vector vInterpHigh = XMVectorCatmullRom(vP0_High_Final, vP1_High_Final, vP2_High_Final, vP3_High_Final, t);
+            _vector vInterpLow = Interpolate_Timed(vP_Low_Final, fT_Final, t);
+            _vector vInterpHigh = Interpolate_Timed(vP_High_Final, fT_Final, t);
 
             XMStoreFloat3(&pVertices[iVtxIdx].vPosition, vInterpLow);
             pVertices[iVtxIdx].vTexcoord = _float2(0.f, (iNumVertices_ThisFrame > 1) ? _float(iVtxIdx) / _float(iNumVertices_ThisFrame - 1) : 0.f);
@@ -269,19 +378,25 @@ void CVIBuffer_Trail::UpdateTrail(_vector vSwordLow, _vector vSwordHigh)
     m_iCurIndexCnt = ((iVtxIdx / 2) - 1) * 6;
     if (m_iCurIndexCnt < 0) m_iCurIndexCnt = 0; // vtxIdx 0 Ǵ 2   
 
-    m_pContext->Unmap(m_pVB, 0);
+    m_pVBAllocator->Unmap_Region(m_iVertexStride * iVtxIdx);
 }
 
 void CVIBuffer_Trail::ClearTrail(_fvector vSwordLow, _fvector vSwordHigh)
 {
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-
     m_TrailPoints.clear();
     m_iCurIndexCnt = 0;
+    m_fSampleAcc = 0.f;
+    m_bVerticesDirty = false;
 
-    if (SUCCEEDED(m_pContext->Map(m_pVB, 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedResource)))
+    if (!m_pVBAllocator)
+        return;
+
+    CDynamicBufferAllocator::ALLOCATION tAlloc = {};
+    if (SUCCEEDED(m_pVBAllocator->Map_Region(m_iVertexStride * m_iNumVertices, &tAlloc)))
     {
-        VTXTRAIL* pVertices = reinterpret_cast<VTXTRAIL*>(mappedResource.pData);
+        m_iBaseVertex = (_int)(tAlloc.iByteOffset / m_iVertexStride);
+
+        VTXTRAIL* pVertices = reinterpret_cast<VTXTRAIL*>(tAlloc.pData);
 
         for (_int i = 0; i < m_iNumVertices; ++i)
         {
@@ -293,7 +408,7 @@ void CVIBuffer_Trail::ClearTrail(_fvector vSwordLow, _fvector vSwordHigh)
             pVertices[i].vTexcoord = _float2((i % 2 == 0) ? 0.f : 1.f, _float(i) / _float(m_iNumVertices - 1));
         }
 
-        m_pContext->Unmap(m_pVB, 0);
+        m_pVBAllocator->Unmap_Region(m_iVertexStride * m_iNumVertices);
     }
 }
 
@@ -301,8 +416,7 @@ HRESULT CVIBuffer_Trail::Get_JsonData(json& jData)
 {
     m_tComponentDesc.to_json(jData);
 
-    jData["iMaxTrailPoints"] = m_iMaxTrailPoints;
-    jData["iCatmullCount"] = m_iCatmullCount;
+    CTrail_Snapshot::To_Json(Get_SnapshotParams(), jData);
 
     return S_OK;
 }
@@ -311,10 +425,67 @@ HRESULT CVIBuffer_Trail::Set_JsonData(json& jData)
 {
     m_tComponentDesc.from_json(jData);
 
-    if (jData.contains("iMaxTrailPoints"))
-        m_iMaxTrailPoints = jData["iMaxTrailPoints"];
-    if (jData.contains("iCatmullCount"))
-        m_iCatmullCount = jData["iCatmullCount"];
+    CTrail_Snapshot::PARAMS tParams = Get_SnapshotParams();
+    CTrail_Snapshot::From_Json(jData, tParams);
+
+    m_iMaxTrailPoints = tParams.iMaxTrailPoints;
+    m_iCatmullCount = tParams.iCatmullCount;
+    Set_SampleRate(tParams.fSampleRate);
+    Set_TessellationRate(tParams.fTessellationRate);
+
+    return S_OK;
+}
+
+HRESULT CVIBuffer_Trail::Save_Snapshot(vector<_byte>& Out) const
+{
+    CTrail_Snapshot::STATE tState;
+    tState.tParams = Get_SnapshotParams();
+    tState.fTime = m_fTime;
+
+    //   
+    tState.Samples.reserve(m_TrailPoints.size());
+    for (auto& tPoint : m_TrailPoints)
+    {
+        CTrail_Snapshot::SAMPLE tSample;
+        XMStoreFloat3(&tSample.vLow, tPoint.vLow);
+        XMStoreFloat3(&tSample.vHigh, tPoint.vHight);
+        tSample.fTime = tPoint.fTime;
+
+        tState.Samples.push_back(tSample);
+    }
+
+    CTrail_Snapshot::Save(tState, Out);
+
+    return S_OK;
+}
+
+HRESULT CVIBuffer_Trail::Load_Snapshot(const _byte* pData, size_t iSize)
+{
+    //  1   ֱ/ð   
+    CTrail_Snapshot::STATE tState;
+    tState.tParams = Get_SnapshotParams();
+    tState.fTime = m_fTime;
+
+    if (FAILED(CTrail_Snapshot::Load(pData, iSize, tState)))
+        return E_FAIL;
+
+    // /ε  ũⰡ    Ƿ ٸ  Ұ(    )
+    if (tState.tParams.iMaxTrailPoints != m_iMaxTrailPoints || tState.tParams.iCatmullCount != m_iCatmullCount)
+        return E_FAIL;
+
+    deque<TRAIL_POINT> TrailPoints;
+    for (auto& tSample : tState.Samples)
+        TrailPoints.push_back({ XMLoadFloat3(&tSample.vLow), XMLoadFloat3(&tSample.vHigh), tSample.fTime });
+
+    Set_SampleRate(tState.tParams.fSampleRate);
+    Set_TessellationRate(tState.tParams.fTessellationRate);
+
+    m_fTime = tState.fTime;
+    m_TrailPoints = move(TrailPoints);
+    m_iCurIndexCnt = 0;
+
+    Build_Vertices();
+    m_bVerticesDirty = false;
 
     return S_OK;
 }
@@ -345,4 +516,7 @@ CComponent* CVIBuffer_Trail::Clone(void* pArg, CGameObject* pOnwer)
 void CVIBuffer_Trail::Free()
 {
     __super::Free();
+
+    Safe_Release(m_pVBAllocator);
+    Safe_Release(m_pVBBackend);
 }
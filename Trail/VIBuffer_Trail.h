@@ -0,0 +1,96 @@
+#pragma once
+#include "VIBuffer_Instancing.h"
+#include "DynamicBufferAllocator.h"
+#include "Trail_Snapshot.h"
+
+BEGIN(Engine)
+
+class ENGINE_DLL CVIBuffer_Trail final : public CVIBuffer_Instancing
+{
+public:
+	struct TRAIL_POINT
+	{
+		_vector vLow;
+		_vector vHight;
+		_float fTime;	//  ð(Ʈ ð ,  ) ->  Catmull-Rom  
+	};
+
+	//  ð  ġ ִ ݹ(ִϸ̼ ý ش ð )
+	using SAMPLER = function<void(_float fSampleTime, _vector* pLow, _vector* pHigh)>;
+
+private:
+	CVIBuffer_Trail(ID3D11Device* pDevice, ID3D11DeviceContext* pContext);
+	CVIBuffer_Trail(const CVIBuffer_Trail& Prototype, CGameObject* pOnwer);
+	virtual ~CVIBuffer_Trail() = default;
+
+public:
+	virtual HRESULT			Initialize_Prototype(CVIBuffer_Instancing::INSTANCE_DESC* pDesc);
+	virtual HRESULT			Initialize(void* pArg) override;
+	virtual HRESULT			Render() override;
+
+public:
+	// Ӹ   ߰ +  ׼̼( , ð  ֱ  ο)
+	void					UpdateTrail(_vector vSwordLow, _vector vSwordHigh);
+	void					ClearTrail(_fvector vSwordLow, _fvector vSwordHigh);
+
+	//  ֱ ø: ð踦 Ű ̹ ӿ   ð Sampler ȣ, ߰   ȯ
+	// ǥ ֻ ϰ   =  ֱ * ð
+	_uint					Advance(_float fTimeDelta, const SAMPLER& Sampler);
+	// Ÿӽ ִ   ߰(   ð ), ׼̼ Update_Tessellation
+	void					Push_Sample(_fvector vSwordLow, _fvector vSwordHigh, _float fTime);
+	//   ְ ׼̼ ֱⰡ    
+	void					Update_Tessellation(_float fTimeDelta);
+
+	// ʴ  
+	void					Set_SampleRate(_float fSampleRate) { m_fSampleRate = max(fSampleRate, 1.f); }
+	// ʴ ׼̼ Ƚ, 0̸ Update_Tessellation ȣ⸶(ְų ȭ  ڴ 缭 )
+	void					Set_TessellationRate(_float fTessellationRate) { m_fTessellationRate = max(fTessellationRate, 0.f); }
+	_float					Get_Time() const { return m_fTime; }
+
+	// ε   , ڰ ǥ Ӹ  (Priority_Update ) ȣ
+	// Render ׸/ٸ ī޶ н   Ҹ  Ƿ ⼭ ȣ 
+	void					Begin_Frame() { if (m_pVBAllocator) m_pVBAllocator->Begin_Frame(); }
+	const CDynamicBufferAllocator::FRAME_STATS* Get_UploadStats() const { return m_pVBAllocator ? &m_pVBAllocator->Get_FrameStats() : nullptr; }
+
+public:
+	virtual HRESULT			Get_JsonData(json& jData) override;
+	virtual HRESULT			Set_JsonData(json& jData) override;
+
+	// Ķ +   ̳ʸ  /( CTrail_Snapshot)
+	//    Ķ(=    ũ)  ۿ 
+	HRESULT					Save_Snapshot(vector<_byte>& Out) const;
+	HRESULT					Load_Snapshot(const _byte* pData, size_t iSize);
+
+private:
+	//   ̹    ٽ 
+	void					Build_Vertices();
+	CTrail_Snapshot::PARAMS	Get_SnapshotParams() const { return { m_iMaxTrailPoints, m_iCatmullCount, m_fSampleRate, m_fTessellationRate }; }
+
+private:
+	deque<TRAIL_POINT>		m_TrailPoints;
+
+	_float					m_fSampleRate = { 60.f };
+	_float					m_fTessellationRate = {};
+	_float					m_fTime = {};				// Ʈ ð
+	_float					m_fSampleAcc = {};			//  ñ  ð
+	_float					m_fTessellationAcc = {};
+	_bool					m_bVerticesDirty = { false };
+
+	_int					m_iMaxTrailPoints = {};
+	_int					m_iCatmullCount = { 4 };
+	_int					m_iCurIndexCnt = {};
+
+	//  ۸  ũ   ȯ(  DISCARD GPU    )
+	static constexpr _uint	NUM_FRAME_REGIONS = 3;
+
+	CDynamicBufferBackend*	m_pVBBackend = { nullptr };
+	CDynamicBufferAllocator* m_pVBAllocator = { nullptr };
+	_int					m_iBaseVertex = {};		// ̹    
+
+public:
+	static CVIBuffer_Trail* Create(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, CVIBuffer_Instancing::INSTANCE_DESC* pDesc);
+	virtual CComponent*		Clone(void* pArg, CGameObject* pOnwer) override;
+	virtual void			Free() override;
+};
+
+END